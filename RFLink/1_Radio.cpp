@@ -8,6 +8,7 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "1_Radio.h"
+#include "2_Signal.h"
 #include "4_Display.h"
 
 uint8_t PIN_RF_RX_PMOS = PIN_RF_RX_PMOS_0;
@@ -40,6 +41,7 @@ void set_Radio_mode(Radio_State new_State)
     switch (new_State)
     {
     case Radio_OFF:
+      stop_Capture();
       PIN_RF_RX_DATA = NOT_A_PIN;
       PIN_RF_TX_DATA = NOT_A_PIN;
       radio.reset();
@@ -60,9 +62,11 @@ void set_Radio_mode(Radio_State new_State)
       radio.attachUserInterrupt(NULL);
       detachInterrupt(0);
       detachInterrupt(1);
+      start_Capture();
       break;
 
     case Radio_TX:
+      stop_Capture();
       radio.receiveEnd();
       PIN_RF_RX_DATA = NOT_A_PIN;
       radio.transmitBegin();
@@ -90,6 +94,7 @@ void set_Radio_mode(Radio_State new_State)
     switch (new_State)
     {
     case Radio_OFF:
+      stop_Capture();
       disableTX();
       disableRX();
       break;
@@ -97,9 +102,11 @@ void set_Radio_mode(Radio_State new_State)
     case Radio_RX:
       disableTX();
       enableRX();
+      start_Capture();
       break;
 
     case Radio_TX:
+      stop_Capture();
       disableRX();
       enableTX();
       break;
@@ -9,6 +9,7 @@
 #define Radio_h
 
 #include <Arduino.h>
+#include "2_Signal.h"
 
 #define TRANSMITTER_STABLE_DELAY_US 500 // 500        // Delay to let the transmitter become stable (Note: Aurel RTX MID needs 500µS/0,5ms).
 #define PULLUP_RF_RX_DATA_0 false       // false      // Sometimes a pullup in needed on RX data pin
@@ -72,7 +73,11 @@ extern boolean PULLUP_RF_RX_DATA;
 #define PIN_RF_RX_VCC_0 4          // Power to the receiver on this pin
 #define PIN_RF_RX_GND_0 NOT_A_PIN  // Ground to the receiver on this pin
 #define PIN_RF_RX_NA_0 3           // Alt. RX_DATA. Forced as input
+#ifdef RF_ICP_ENABLED
+#define PIN_RF_RX_DATA_0 8         // ICP1 input capture pin, fixed. LOW when no signal.
+#else
 #define PIN_RF_RX_DATA_0 2         // On this input, the 433Mhz-RF signal is received. LOW when no signal.
+#endif
 #define PIN_RF_TX_PMOS_0 NOT_A_PIN // High Side P-MOSFET, active on LOW level
 #define PIN_RF_TX_NMOS_0 NOT_A_PIN // Low Side N-MOSFET, active on HIGH level
 #define PIN_RF_TX_VCC_0 NOT_A_PIN  // +5 volt / Vcc power to the transmitter on this pin
@@ -87,7 +92,11 @@ extern boolean PULLUP_RF_RX_DATA;
 #define PIN_RF_RX_VCC_0 16         // Power to the receiver on this pin
 #define PIN_RF_RX_GND_0 NOT_A_PIN  // Ground to the receiver on this pin
 #define PIN_RF_RX_NA_0 NOT_A_PIN   // Alt. RX_DATA. Forced as input
+#ifdef RF_ICP_ENABLED
+#define PIN_RF_RX_DATA_0 48        // ICP5 input capture pin (ICP1 is not wired out), fixed. LOW when no signal.
+#else
 #define PIN_RF_RX_DATA_0 19        // On this input, the 433Mhz-RF signal is received. LOW when no signal.
+#endif
 #define PIN_RF_TX_PMOS_0 NOT_A_PIN // High Side P-MOSFET, active on LOW level
 #define PIN_RF_TX_NMOS_0 NOT_A_PIN // Low Side N-MOSFET, active on HIGH level
 #define PIN_RF_TX_VCC_0 15         // +5 volt / Vcc power to the transmitter on this pin
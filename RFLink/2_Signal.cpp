@@ -8,36 +8,879 @@
 #include <Arduino.h>
 #include "1_Radio.h"
 #include "2_Signal.h"
+#include "4_Display.h"
 #include "5_Plugin.h"
 
-RawSignalStruct RawSignal = {0, 0, 0, 0, 0UL};
+RawSignalStruct RawSignal = {};
 unsigned long SignalCRC = 0L;   // holds the bitstream value for some plugins to identify RF repeats
 unsigned long SignalCRC_1 = 0L; // holds the previous SignalCRC (for mixed burst protocols)
 byte SignalHash = 0L;           // holds the processed plugin number
 byte SignalHashPrevious = 0L;   // holds the last processed plugin number
 unsigned long RepeatingTimer = 0L;
+unsigned long GlitchFolded = 0L;  // garbage pulses folded into their neighbours
+unsigned long GlitchRescued = 0L; // packets that needed folding to be received
+unsigned long RepeatsDropped = 0L; // packets dropped by RepeatedSignal() before the plugins
+
+#ifdef RAW_PULSE_LOG8
+// Length in uSec of each log code, the inverse of PulseLog8()
+const uint16_t PulseLog8_us[256] PROGMEM = {
+    0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120,
+    128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+    256, 264, 272, 280, 288, 296, 304, 312, 320, 328, 336, 344, 352, 360, 368, 376,
+    384, 392, 400, 408, 416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504,
+    512, 528, 544, 560, 576, 592, 608, 624, 640, 656, 672, 688, 704, 720, 736, 752,
+    768, 784, 800, 816, 832, 848, 864, 880, 896, 912, 928, 944, 960, 976, 992, 1008,
+    1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248, 1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+    1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760, 1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+    2048, 2112, 2176, 2240, 2304, 2368, 2432, 2496, 2560, 2624, 2688, 2752, 2816, 2880, 2944, 3008,
+    3072, 3136, 3200, 3264, 3328, 3392, 3456, 3520, 3584, 3648, 3712, 3776, 3840, 3904, 3968, 4032,
+    4096, 4224, 4352, 4480, 4608, 4736, 4864, 4992, 5120, 5248, 5376, 5504, 5632, 5760, 5888, 6016,
+    6144, 6272, 6400, 6528, 6656, 6784, 6912, 7040, 7168, 7296, 7424, 7552, 7680, 7808, 7936, 8064,
+    8192, 8448, 8704, 8960, 9216, 9472, 9728, 9984, 10240, 10496, 10752, 11008, 11264, 11520, 11776, 12032,
+    12288, 12544, 12800, 13056, 13312, 13568, 13824, 14080, 14336, 14592, 14848, 15104, 15360, 15616, 15872, 16128,
+    16384, 16896, 17408, 17920, 18432, 18944, 19456, 19968, 20480, 20992, 21504, 22016, 22528, 23040, 23552, 24064,
+    24576, 25088, 25600, 26112, 26624, 27136, 27648, 28160, 28672, 29184, 29696, 30208, 30720, 31232, 31744, 32256,
+};
+#endif
+
+// ***********************************************************************************
+// Pulse clustering, run once per packet so decoders can share the short/long decision
+// Greedy grouping in uSec, then the closest neighbours are merged down to SIGNAL_CLUSTERS.
+// ***********************************************************************************
+#ifdef SIGNAL_CLUSTERING
+#define CLUSTER_SLOTS (SIGNAL_CLUSTERS * 2) // Provisional clusters before merging
+
+void ClusterSignal(RawSignalStruct &Signal)
+{
+  unsigned long Sum[CLUSTER_SLOTS];
+  unsigned long Mean[CLUSTER_SLOTS];
+  unsigned int Count[CLUSTER_SLOTS];
+  byte Clusters = 0;
+  byte c, k;
+
+  Signal.Clusters = 0;
+  if (Signal.Number <= 0)
+    return;
+
+  // ***   Group pulses of about the same length   ***
+  for (int x = 1; x <= Signal.Number; x++)
+  {
+    unsigned long us = PULSE_TO_US(Signal.Pulses[x]);
+    byte Nearest = 0;
+    unsigned long Distance = 0xFFFFFFFFUL;
+
+    for (c = 0; c < Clusters; c++)
+    {
+      unsigned long d = (us > Mean[c]) ? us - Mean[c] : Mean[c] - us;
+      if (d < Distance)
+      {
+        Distance = d;
+        Nearest = c;
+      }
+    }
+
+    if ((Clusters == 0 || Distance > Mean[Nearest] / SIGNAL_CLUSTER_SPREAD) && Clusters < CLUSTER_SLOTS)
+    {
+      Nearest = Clusters++;
+      Sum[Nearest] = 0;
+      Count[Nearest] = 0;
+    }
+    Sum[Nearest] += us;
+    Count[Nearest]++;
+    Mean[Nearest] = Sum[Nearest] / Count[Nearest];
+  }
+
+  // ***   Sort, shortest first   ***
+  for (c = 1; c < Clusters; c++)
+    for (k = c; k > 0 && Mean[k - 1] > Mean[k]; k--)
+    {
+      unsigned long s = Sum[k], m = Mean[k];
+      unsigned int n = Count[k];
+      Sum[k] = Sum[k - 1], Mean[k] = Mean[k - 1], Count[k] = Count[k - 1];
+      Sum[k - 1] = s, Mean[k - 1] = m, Count[k - 1] = n;
+    }
+
+  // ***   Merge the two neighbours with the smallest ratio   ***
+  while (Clusters > SIGNAL_CLUSTERS)
+  {
+    k = 0;
+    for (c = 1; c < Clusters - 1; c++)
+      if (Mean[c + 1] * Mean[k] < Mean[k + 1] * Mean[c]) // Mean[c+1]/Mean[c] < Mean[k+1]/Mean[k]
+        k = c;
+    Sum[k] += Sum[k + 1];
+    Count[k] += Count[k + 1];
+    Mean[k] = Sum[k] / Count[k];
+    Clusters--;
+    for (c = k + 1; c < Clusters; c++)
+      Sum[c] = Sum[c + 1], Mean[c] = Mean[c + 1], Count[c] = Count[c + 1];
+  }
+
+  // ***   Symbol of each pulse: the nearest centroid   ***
+  RawPulse Bound[SIGNAL_CLUSTERS - 1]; // stored length halfway between two centroids
+  for (c = 0; c < Clusters; c++)
+  {
+    Signal.Centroid[c] = PULSE_US(Mean[c]);
+    if (c > 0)
+      Bound[c - 1] = PULSE_US((Mean[c - 1] + Mean[c]) / 2);
+  }
+
+  memset(Signal.Symbols, 0, sizeof(Signal.Symbols));
+  for (int x = 1; x <= Signal.Number; x++)
+  {
+    byte Symbol = 0;
+    while (Symbol < Clusters - 1 && Signal.Pulses[x] > Bound[Symbol])
+      Symbol++;
+    Signal.Symbols[x >> 2] |= Symbol << ((x & 3) << 1);
+  }
+  Signal.Clusters = Clusters;
+}
+#endif // SIGNAL_CLUSTERING
+
+// ***********************************************************************************
+// Retransmit hash: FNV-1a over the pulses in SIGNAL_HASH_QUANTUM_US steps, the ending gap
+// is left out as it differs between repeats. Buffered capture adds each pulse as it is stored.
+// Not taken over the cluster symbols: those only tell the timing classes apart, two packets
+// with the same pattern but other timings would look like repeats.
+// ***********************************************************************************
+#define SIGNAL_HASH_START 2166136261UL
+
+static inline unsigned long HashPulse(unsigned long Hash, unsigned long PulseLength_us)
+{
+  return (Hash ^ (PulseLength_us / SIGNAL_HASH_QUANTUM_US)) * 16777619UL;
+}
+
+#if (!defined(RF_BUFFERED_CAPTURE) && SIGNAL_HASH_SLOTS > 0)
+static unsigned long HashSignal(const RawSignalStruct &Signal)
+{ // Polled capture, after the timing loop so it keeps its pace
+  unsigned long Hash = SIGNAL_HASH_START;
+
+  for (int x = 1; x < Signal.Number; x++)
+    Hash = HashPulse(Hash, PULSE_TO_US(Signal.Pulses[x]));
+  return Hash ^ Signal.Number;
+}
+#endif
+
+#ifdef SIGNAL_CLUSTERING
+// Lowest symbol of RawSignal with a centroid above Threshold, pulses with PULSE_SYMBOL(x) >= it are long
+byte SymbolAbove(RawPulse Threshold)
+{
+  byte Symbol = 0;
+
+  while (Symbol < RawSignal.Clusters && RawSignal.Centroid[Symbol] <= Threshold)
+    Symbol++;
+  return Symbol;
+}
+#endif
+
+#ifdef RF_RMT_ENABLED
+#include <driver/rmt.h>
+
+#define RMT_CLK_DIV 80          // 80MHz APB clock / 80 = 1 uSec per RMT tick
+#define RMT_FILTER_TICKS 255    // Hardware glitch filter, in APB ticks (255 = 3.2 uSec)
+#define RMT_RINGBUF_FRAMES 4    // Full RMT frames the driver ring buffer can hold
+#endif
+
+#if (defined(RF_ISR_ENABLED) || defined(RF_ICP_ENABLED))
+// ***********************************************************************************
+// Edge ring buffer: single producer (RX interrupt), single consumer (FetchSignal)
+// Each entry is the length in uSec (timer ticks with RF_ICP_ENABLED) of the level that
+// just ended, bit 15 is that level.
+// ***********************************************************************************
+#define EDGE_LEVEL_BIT 0x8000U
+#define EDGE_LENGTH_MAX 0x7FFFU
+
+#if EDGE_RING_SIZE > 256
+typedef uint16_t EdgeIndex;
+#else
+typedef byte EdgeIndex; // a byte is read and written atomically on AVR
+#endif
+
+static volatile uint16_t EdgeRing[EDGE_RING_SIZE];
+static volatile EdgeIndex EdgeHead = 0;        // only written by the RX interrupt
+static volatile EdgeIndex EdgeTail = 0;        // only written by FetchSignal()
+#ifdef RF_ISR_ENABLED
+static volatile unsigned long EdgeTime_us = 0; // micros() of the last edge
+#endif
+volatile unsigned long EdgeOverflow = 0;       // edges lost because the ring was full
+
+static unsigned long EdgeOverflowCount()
+{ // One snapshot, AVR reads a long in 4 steps the interrupt may come between
+  noInterrupts();
+  unsigned long Count = EdgeOverflow;
+  interrupts();
+  return Count;
+}
+#endif
+
+#if SIGNAL_HASH_SLOTS > 0
+// ***********************************************************************************
+// Hashes of the last decoded packets, a packet matching one of them within SIGNAL_REPEAT_TIME_MS
+// is a retransmit and never reaches the plugins. Copies of a packet no plugin decoded still do.
+// ***********************************************************************************
+static struct
+{
+  unsigned long Hash;
+  unsigned long Time; // millis() of the last copy
+} RecentSignal[SIGNAL_HASH_SLOTS];
+#endif
+
+static boolean RepeatedSignal()
+{
+#if SIGNAL_HASH_SLOTS > 0
+  if (RawSignal.Hash == 0 || RFDebug || QRFDebug) // Debug output shows every packet
+    return false;
+
+  for (byte i = 0; i < SIGNAL_HASH_SLOTS; i++)
+    if (RecentSignal[i].Hash == RawSignal.Hash && RawSignal.Time - RecentSignal[i].Time < SIGNAL_REPEAT_TIME_MS)
+    {
+      RecentSignal[i].Time = RawSignal.Time; // the next repeat is timed from this copy
+      RepeatsDropped++;
+      return true;
+    }
+#endif
+  return false;
+}
+
+static void RecordSignal()
+{ // A plugin decoded RawSignal, its retransmits can go
+#if SIGNAL_HASH_SLOTS > 0
+  byte Oldest = 0;
+
+  if (RawSignal.Hash == 0)
+    return;
+
+  for (byte i = 1; i < SIGNAL_HASH_SLOTS; i++)
+    if (RawSignal.Time - RecentSignal[i].Time > RawSignal.Time - RecentSignal[Oldest].Time)
+      Oldest = i;
+  RecentSignal[Oldest].Hash = RawSignal.Hash;
+  RecentSignal[Oldest].Time = RawSignal.Time;
+#endif
+}
 
 /*********************************************************************************************/
 boolean ScanEvent(void)
 { // Deze routine maakt deel uit van de hoofdloop en wordt iedere 125uSec. doorlopen
+#ifdef RF_BUFFERED_CAPTURE
+  // Pulses are buffered in the background, no need to spin on the pin here
+  if (FetchSignal())
+  { // RF: *** data start ***
+    if (RepeatedSignal())
+      return false; // Same packet as less than SIGNAL_REPEAT_TIME_MS ago
+    if (PluginRXCall(0, 0))
+    { // Check all plugins to see which plugin can handle the received signal.
+      RecordSignal();
+      RepeatingTimer = millis() + SIGNAL_REPEAT_TIME_MS;
+      return true;
+    }
+  }
+#ifndef RF_TASKS_ENABLED
+  else
+    delay(1); // Everything pending was consumed, leave the CPU to WiFi/idle
+#endif
+  return false;
+#else
   unsigned long Timer = millis() + SCAN_HIGH_TIME_MS;
 
   while (Timer > millis()) // || RepeatingTimer > millis())
   {
     // delay(1); // For Modem Sleep
-    if (FetchSignal())
+    if (FetchSignal() && !RepeatedSignal())
     { // RF: *** data start ***
       if (PluginRXCall(0, 0))
       { // Check all plugins to see which plugin can handle the received signal.
+        RecordSignal();
         RepeatingTimer = millis() + SIGNAL_REPEAT_TIME_MS;
         return true;
       }
     }
   } // while
   return false;
+#endif
+}
+
+#ifdef RF_BUFFERED_CAPTURE
+// ***********************************************************************************
+// RawSignal slot pool: the assembler fills SlotFill() while complete packets wait in
+// the older slots until FetchSignal() hands them over to the plugins.
+// ***********************************************************************************
+#ifdef RF_TASKS_ENABLED
+// With tasks the pool is a FreeRTOS queue: the capture task assembles into RawSlot[0]
+// and queues a copy, the decode task receives the oldest one into RawSlot[1].
+static RawSignalStruct RawSlot[2];
+static QueueHandle_t PacketQueue = NULL;
+static SemaphoreHandle_t CaptureLock = NULL; // held by the capture task for each pass, and while the buffers are reset
+TaskHandle_t CaptureTaskHandle = NULL;
+#else
+// Without tasks the assembler and NextSignal() both run from FetchSignal(), and the
+// slot after the complete ones is filled: all RAW_SLOTS can hold a waiting packet.
+static RawSignalStruct RawSlot[RAW_SLOTS];
+static byte SlotTail = 0;  // oldest complete slot, only moved by NextSignal()
+static byte SlotCount = 0; // complete slots, SlotTail first
+#endif
+unsigned long RawSlotDropped = 0; // waits for a free slot, and edge overflows during such a wait
+static boolean SlotStalled = false; // the assembler left input behind for lack of a slot
+
+byte RawSlotsQueued()
+{
+#ifdef RF_TASKS_ENABLED
+  return uxQueueMessagesWaiting(PacketQueue);
+#else
+  return SlotCount;
+#endif
+}
+
+static boolean SlotFree()
+{ // Room for one more packet, while there is none the assembler leaves the edges or RMT frames where they are
+#ifdef RF_TASKS_ENABLED
+  return uxQueueSpacesAvailable(PacketQueue) > 0;
+#else
+  return SlotCount < RAW_SLOTS;
+#endif
+}
+
+static RawSignalStruct &SlotFill()
+{ // Slot the assembler fills, only valid while SlotFree()
+#ifdef RF_TASKS_ENABLED
+  return RawSlot[0];
+#else
+  return RawSlot[(SlotTail + SlotCount) % RAW_SLOTS];
+#endif
+}
+
+static void SlotStall(boolean Pending)
+{ // The assembler stops: with input left behind the first pass of the wait counts as a drop
+  if (Pending && !SlotStalled)
+    RawSlotDropped++;
+  SlotStalled = Pending;
+}
+
+static boolean NextSignal()
+{
+#ifdef RF_TASKS_ENABLED
+  // Waits for the capture task, the decode task checks for commands in between
+  if (xQueueReceive(PacketQueue, &RawSlot[1], pdMS_TO_TICKS(TASK_WAIT_MS)) != pdTRUE)
+    return false;
+  const RawSignalStruct &Slot = RawSlot[1];
+#else
+  if (SlotCount == 0)
+    return false;
+  const RawSignalStruct &Slot = RawSlot[SlotTail];
+#endif
+
+  RawSignal.Number = Slot.Number;
+  RawSignal.Multiply = Slot.Multiply;
+  RawSignal.Time = Slot.Time;
+  memcpy(RawSignal.Pulses, Slot.Pulses, (Slot.Number + 2) * sizeof(RawPulse)); // Hint element, pulses and the ending 0
+  RawSignal.Hash = Slot.Hash;
+#ifdef SIGNAL_CLUSTERING
+  RawSignal.Clusters = Slot.Clusters;
+  memcpy(RawSignal.Centroid, Slot.Centroid, sizeof(Slot.Centroid));
+  memcpy(RawSignal.Symbols, Slot.Symbols, Slot.Number / 4 + 1);
+#endif
+#ifndef RF_TASKS_ENABLED
+  SlotTail = (SlotTail + 1) % RAW_SLOTS;
+  SlotCount--;
+#endif
+  return true;
 }
 
-#if (defined(ESP32) || defined(ESP8266))
+// ***********************************************************************************
+// Packet assembler, runs from FetchSignal() off the interrupt path
+// ***********************************************************************************
+static unsigned int RawCodeLength = 0; // 0 while seeking a preamble
+static byte FrameGlitches = 0;           // garbage pulses folded into the frame being assembled
+static unsigned long GlitchCarry_us = 0;  // interrupted pulse + garbage pulse, the next pulse continues it
+static unsigned long LastPulse_us = 0;    // last stored pulse, in case a garbage pulse follows
+#ifdef SIGNAL_SEGMENT_GAP_US
+static unsigned long FrameLongest_us = 0; // longest pulse of the frame being assembled
+#endif
+static unsigned long FrameHash = 0;       // retransmit hash of the pulses stored so far
+static unsigned long FrameHashBefore = 0; // the same before the last pulse, in case a garbage pulse takes it back
+
+static void ResetFrame()
+{ // Drops the frame being assembled, a pending glitch with it, and seeks a preamble again
+  RawCodeLength = 0;
+  FrameGlitches = 0;
+  GlitchCarry_us = 0;
+}
+
+static boolean StoreSignal(unsigned int MinPulses)
+{
+  if (RawCodeLength < MinPulses)
+    return false;
+  if (FrameGlitches)
+    GlitchRescued++;
+
+  RawSignalStruct &Slot = SlotFill();
+
+  Slot.Number = RawCodeLength - 1;  // Number of received pulse times (pulsen *2)
+  Slot.Pulses[Slot.Number + 1] = 0; // Last element contains the timeout.
+  Slot.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  Slot.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+  Slot.Hash = FrameHash ^ Slot.Number;
+  ClusterSignal(Slot); // Off the decode path when the capture task is running
+
+#ifdef RF_TASKS_ENABLED
+  xQueueSend(PacketQueue, &Slot, 0); // SlotFree() made sure there is room
+#else
+  SlotCount++;
+#endif
+  return true;
+}
+
+static boolean AssemblePulse(unsigned long PulseLength_us, boolean Mark)
+{
+  RawPulse *Pulses = SlotFill().Pulses;
+
+  // ***   Scan for Preamble Pulse   ***
+  if (RawCodeLength == 0)
+  {
+    if (!Mark && PulseLength_us >= SIGNAL_MIN_PREAMBLE_US)
+      RawCodeLength = 1;
+    return false;
+  }
+
+  // ***   Glitch Folding   ***
+  if (GlitchCarry_us)
+  { // This pulse continues the one a garbage pulse interrupted
+    PulseLength_us += GlitchCarry_us;
+    GlitchCarry_us = 0;
+  }
+
+  // ***   Too short Pulse Check   ***
+  if (PulseLength_us < MIN_PULSE_LENGTH_US)
+  {
+    if (RawCodeLength > 2 && FrameGlitches < SIGNAL_GLITCH_BUDGET)
+    { // Take back the previous pulse, the next one gets both added
+      FrameGlitches++;
+      GlitchFolded++;
+      RawCodeLength--;
+      FrameHash = FrameHashBefore;
+      GlitchCarry_us = LastPulse_us + PulseLength_us;
+      return false;
+    }
+    ResetFrame();
+    return false;
+  }
+
+  // ***   Ending Pulse Check   ***
+  if (PulseLength_us > SIGNAL_END_TIMEOUT_US)
+  {
+    Pulses[RawCodeLength++] = PULSE_US(PulseLength_us);
+    boolean complete = StoreSignal(MIN_RAW_PULSES);
+    RawCodeLength = 1; // The ending gap is also the preamble of the next packet
+    return complete;
+  }
+
+#ifdef SIGNAL_SEGMENT_GAP_US
+  // ***   Frame Gap Check   ***
+  // Repeats and sub-frames become packets of their own instead of filling the buffer
+  if (!Mark && RawCodeLength >= SIGNAL_MIN_SEGMENT && PulseLength_us >= SIGNAL_SEGMENT_GAP_US && PulseLength_us >= 2 * FrameLongest_us)
+  {
+    Pulses[RawCodeLength++] = PULSE_US(PulseLength_us);
+    boolean complete = StoreSignal(SIGNAL_MIN_SEGMENT);
+    RawCodeLength = 1; // The gap is also the preamble of the next frame
+    return complete;
+  }
+#endif
+
+  // ***   Store Pulse   ***
+  if (RawCodeLength == 1)
+  {
+    Pulses[0] = 0; // Element 0 is reserved for plugin hints
+    FrameGlitches = 0;
+    FrameHash = SIGNAL_HASH_START;
+#ifdef SIGNAL_SEGMENT_GAP_US
+    FrameLongest_us = 0;
+#endif
+  }
+#ifdef SIGNAL_SEGMENT_GAP_US
+  if (RawCodeLength > 2 && PulseLength_us > FrameLongest_us) // Start bit and sync space are no data
+    FrameLongest_us = PulseLength_us;
+#endif
+  LastPulse_us = PulseLength_us;
+  FrameHashBefore = FrameHash;
+  FrameHash = HashPulse(FrameHash, PulseLength_us);
+  Pulses[RawCodeLength++] = PULSE_US(PulseLength_us);
+  if (RawCodeLength < RAW_BUFFER_SIZE)
+    return false;
+
+  boolean complete = StoreSignal(MIN_RAW_PULSES);
+  RawCodeLength = 0;
+  return complete;
+}
+
+static boolean AssembleEnd()
+{ // The line went quiet, close the packet with a timeout gap
+  GlitchCarry_us = 0; // A garbage pulse just before the silence, its pulse is lost
+  if (RawCodeLength <= 1)
+    return false;
+
+  SlotFill().Pulses[RawCodeLength++] = PULSE_US(SIGNAL_END_TIMEOUT_US);
+  boolean complete = StoreSignal(MIN_RAW_PULSES);
+  RawCodeLength = 0; // The pending gap will show up as the next preamble
+  return complete;
+}
+
+static void AssembleSignals(); // Backend specific, moves everything timed so far into the slots
+
+// ***********************************************************************************
+boolean FetchSignal()
+{
+#ifndef RF_TASKS_ENABLED
+  AssembleSignals();
+#endif
+  return NextSignal();
+}
+
+#ifdef RF_TASKS_ENABLED
+static void CaptureTask(void *)
+{
+  for (;;)
+  {
+    xSemaphoreTake(CaptureLock, portMAX_DELAY);
+    AssembleSignals();
+    xSemaphoreGive(CaptureLock);
+    vTaskDelay(1); // Edges and RMT frames stay buffered in the meantime
+  }
+}
+
+void start_CaptureTask()
+{
+  PacketQueue = xQueueCreate(RAW_SLOTS, sizeof(RawSignalStruct));
+  CaptureLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(CaptureTask, "RF_Capture", CAPTURE_TASK_STACK, NULL, 2, &CaptureTaskHandle, CAPTURE_TASK_CORE);
+}
+
+static void lock_Capture(boolean lock)
+{ // Waits for the capture task to finish its pass, it stays out of the buffers until unlocked
+  if (CaptureLock == NULL)
+    return;
+  if (lock)
+    xSemaphoreTake(CaptureLock, portMAX_DELAY);
+  else
+    xSemaphoreGive(CaptureLock);
+}
+#else
+#define lock_Capture(lock)
+#endif
+
+#endif
+
+#ifdef RF_ISR_ENABLED
+// ***********************************************************************************
+void IRAM_ATTR RF_EdgeISR()
+{
+  unsigned long now_us = micros();
+  unsigned long length_us = now_us - EdgeTime_us;
+  EdgeIndex next = (EdgeHead + 1) & (EDGE_RING_SIZE - 1);
+
+  EdgeTime_us = now_us;
+  if (next == EdgeTail)
+  { // FetchSignal() is late, drop the edge
+    EdgeOverflow++;
+    return;
+  }
+  if (length_us > EDGE_LENGTH_MAX)
+    length_us = EDGE_LENGTH_MAX;
+  // The level that just ended is the opposite of the current one
+  EdgeRing[EdgeHead] = length_us | (digitalRead(PIN_RF_RX_DATA) ? 0 : EDGE_LEVEL_BIT);
+  EdgeHead = next;
+}
+
+static unsigned long EdgeOverflow_seen = 0;
+
+void start_Capture()
+{
+  lock_Capture(true);
+  detachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA));
+  EdgeHead = EdgeTail = 0;
+  ResetFrame();
+  EdgeTime_us = micros();
+  attachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA), RF_EdgeISR, CHANGE);
+  lock_Capture(false);
+}
+
+void stop_Capture()
+{
+  lock_Capture(true);
+  detachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA));
+  ResetFrame();
+  lock_Capture(false);
+}
+
+// ***********************************************************************************
+static void AssembleSignals()
+{
+  unsigned long Overflow = EdgeOverflowCount();
+
+  if (Overflow != EdgeOverflow_seen)
+  { // Edges were dropped, the packet under construction is broken
+    if (SlotStalled)
+      RawSlotDropped++; // The ring filled up while all slots were waiting
+    EdgeOverflow_seen = Overflow;
+    ResetFrame();
+  }
+
+  boolean Room = SlotFree();
+
+  while (Room && EdgeTail != EdgeHead)
+  {
+    uint16_t Edge = EdgeRing[EdgeTail];
+    EdgeTail = (EdgeTail + 1) & (EDGE_RING_SIZE - 1);
+    if (AssemblePulse(Edge & EDGE_LENGTH_MAX, Edge & EDGE_LEVEL_BIT))
+      Room = SlotFree(); // The plugins are late, the next edges wait in the ring
+  }
+  SlotStall(EdgeTail != EdgeHead);
+
+  // ***   Ending Pulse Check, when the line stays quiet no more edge will come   ***
+  if (Room && EdgeTail == EdgeHead && (micros() - EdgeTime_us) > SIGNAL_END_TIMEOUT_US)
+    AssembleEnd();
+}
+#elif defined(RF_RMT_ENABLED)
+// ***********************************************************************************
+// RMT receiver: the peripheral times every level in hardware and closes a frame after
+// SIGNAL_END_TIMEOUT_US of silence. The driver interrupt moves frames to a ring buffer.
+// ***********************************************************************************
+static RingbufHandle_t RMT_RingBuf = NULL;
+static rmt_item32_t *RMT_Items = NULL; // received item, returned once all its frames are in the slots
+static size_t RMT_Pulses = 0;          // pulses of RMT_Items, 2 per rmt_item32_t
+static size_t RMT_Next = 0;            // next pulse to assemble
+
+void start_Capture()
+{
+  const rmt_channel_t channel = (rmt_channel_t)RMT_RX_CHANNEL;
+
+  lock_Capture(true);
+  if (RMT_RingBuf == NULL)
+  {
+    rmt_config_t config = {};
+    config.rmt_mode = RMT_MODE_RX;
+    config.channel = channel;
+    config.gpio_num = (gpio_num_t)PIN_RF_RX_DATA;
+    config.clk_div = RMT_CLK_DIV;
+    config.mem_block_num = RMT_RX_MEM_BLOCKS;
+    config.rx_config.filter_en = true;
+    config.rx_config.filter_ticks_thresh = RMT_FILTER_TICKS;
+    config.rx_config.idle_threshold = SIGNAL_END_TIMEOUT_US; // uSec, as one tick is 1 uSec
+    rmt_config(&config);
+    rmt_driver_install(channel, RMT_RINGBUF_FRAMES * RMT_RX_MEM_BLOCKS * 64 * sizeof(rmt_item32_t), 0);
+    rmt_get_ringbuf_handle(channel, &RMT_RingBuf);
+  }
+  ResetFrame();
+  rmt_rx_start(channel, true);
+  lock_Capture(false);
+}
+
+void stop_Capture()
+{
+  lock_Capture(true);
+  if (RMT_RingBuf != NULL)
+    rmt_rx_stop((rmt_channel_t)RMT_RX_CHANNEL);
+  if (RMT_Items != NULL)
+  { // The frames left in it go with the capture
+    vRingbufferReturnItem(RMT_RingBuf, (void *)RMT_Items);
+    RMT_Items = NULL;
+  }
+  ResetFrame();
+  lock_Capture(false);
+}
+
+// ***********************************************************************************
+static void AssembleSignals()
+{
+  if (RMT_RingBuf == NULL)
+    return;
+
+  boolean Room = SlotFree();
+
+  for (;;)
+  {
+    if (RMT_Items == NULL)
+    {
+      size_t Size = 0;
+
+      RMT_Items = (rmt_item32_t *)xRingbufferReceive(RMT_RingBuf, &Size, 0);
+      if (RMT_Items == NULL)
+        break;
+      RMT_Pulses = Size / sizeof(rmt_item32_t) * 2;
+      RMT_Next = 0;
+      RawCodeLength = 1; // A frame always follows the idle threshold, which is our preamble
+    }
+    // An item can hold several frames split at their gaps, each one needs a free slot
+    while (Room && RMT_Next < RMT_Pulses)
+    {
+      const rmt_item32_t &Item = RMT_Items[RMT_Next / 2];
+      unsigned long PulseLength_us = (RMT_Next & 1) ? Item.duration1 : Item.duration0;
+      boolean Mark = (RMT_Next & 1) ? Item.level1 : Item.level0;
+
+      RMT_Next++;
+      if (PulseLength_us == 0)
+        RMT_Next = RMT_Pulses; // End marker, the line went idle
+      else if (AssemblePulse(PulseLength_us, Mark))
+        Room = SlotFree();
+    }
+    if (RMT_Next < RMT_Pulses)
+      break; // The plugins are late, the rest of the item waits for a free slot
+    vRingbufferReturnItem(RMT_RingBuf, (void *)RMT_Items);
+    RMT_Items = NULL;
+    AssembleEnd(); // Stores nothing without a free slot: the last frame of the item was just stored
+    Room = SlotFree();
+  }
+  SlotStall(RMT_Items != NULL);
+}
+#elif defined(RF_ICP_ENABLED)
+// ***********************************************************************************
+// Timer input capture: the timer latches its count on every RX edge in hardware, the
+// interrupt only stores the difference. Exact at any F_CPU, the CPU is free in between.
+// ATmega328P: Timer1 / ICP1 (D8). Mega: Timer5 / ICP5 (D48), its ICP1 is not wired out.
+// The timer is taken over, analogWrite() on its PWM pins no longer works.
+// ***********************************************************************************
+#if defined(__AVR_ATmega2560__)
+#define ICP_TCCRA TCCR5A
+#define ICP_TCCRB TCCR5B
+#define ICP_TCNT TCNT5
+#define ICP_ICR ICR5
+#define ICP_TIMSK TIMSK5
+#define ICP_TIFR TIFR5
+#define ICP_ICNC ICNC5
+#define ICP_ICES ICES5
+#define ICP_CS CS51
+#define ICP_ICIE ICIE5
+#define ICP_TOIE TOIE5
+#define ICP_ICF ICF5
+#define ICP_TOV TOV5
+#define ICP_CAPT_vect TIMER5_CAPT_vect
+#define ICP_OVF_vect TIMER5_OVF_vect
+#else
+#define ICP_TCCRA TCCR1A
+#define ICP_TCCRB TCCR1B
+#define ICP_TCNT TCNT1
+#define ICP_ICR ICR1
+#define ICP_TIMSK TIMSK1
+#define ICP_TIFR TIFR1
+#define ICP_ICNC ICNC1
+#define ICP_ICES ICES1
+#define ICP_CS CS11
+#define ICP_ICIE ICIE1
+#define ICP_TOIE TOIE1
+#define ICP_ICF ICF1
+#define ICP_TOV TOV1
+#define ICP_CAPT_vect TIMER1_CAPT_vect
+#define ICP_OVF_vect TIMER1_OVF_vect
+#endif
+
+#define ICP_TICKS_TO_US(ticks) (((unsigned long)(ticks) * ICP_PRESCALER) / (F_CPU / 1000000UL))
+
+static volatile uint16_t IcpLast = 0; // timer count at the last edge
+static volatile byte IcpWraps = 0;    // timer wraps since the last edge, stops at 2
+
+ISR(ICP_CAPT_vect)
+{
+  uint16_t now = ICP_ICR;
+  // The level that just ended: a rising edge ends a low level
+  uint16_t level = (ICP_TCCRB & _BV(ICP_ICES)) ? 0 : EDGE_LEVEL_BIT;
+  EdgeIndex next = (EdgeHead + 1) & (EDGE_RING_SIZE - 1);
+
+  ICP_TCCRB ^= _BV(ICP_ICES); // Catch the opposite edge next
+  ICP_TIFR = _BV(ICP_ICF);    // Needed after changing the edge
+  if ((ICP_TIFR & _BV(ICP_TOV)) && now < 0x8000U)
+  { // The timer wrapped before this edge, but the overflow interrupt did not run yet
+    ICP_TIFR = _BV(ICP_TOV);
+    if (IcpWraps < 2)
+      IcpWraps++;
+  }
+
+  uint16_t ticks = now - IcpLast;
+  if (IcpWraps > 1 || (IcpWraps == 1 && now >= IcpLast) || ticks > EDGE_LENGTH_MAX)
+    ticks = EDGE_LENGTH_MAX;
+  IcpLast = now;
+  IcpWraps = 0;
+
+  if (next == EdgeTail)
+  { // FetchSignal() is late, drop the edge
+    EdgeOverflow++;
+    return;
+  }
+  EdgeRing[EdgeHead] = ticks | level;
+  EdgeHead = next;
+}
+
+ISR(ICP_OVF_vect)
+{
+  if (IcpWraps < 2)
+    IcpWraps++;
+}
+
+static unsigned long EdgeOverflow_seen = 0;
+
+uint16_t read_Capture_Timer()
+{
+  noInterrupts(); // A 16 bit timer read goes through the TEMP register the capture interrupt uses too
+  uint16_t Ticks = ICP_TCNT;
+  interrupts();
+  return Ticks;
+}
+
+void start_Capture()
+{
+  noInterrupts();
+  ICP_TIMSK = 0;
+  ICP_TCCRA = 0;                               // Normal counting, no PWM
+  ICP_TCCRB = _BV(ICP_ICNC) | _BV(ICP_CS);     // Noise canceler, F_CPU / 8
+  if (digitalRead(PIN_RF_RX_DATA) == LOW)
+    ICP_TCCRB |= _BV(ICP_ICES);                // Line at rest, the next edge is rising
+  EdgeHead = EdgeTail = 0;
+  ResetFrame();
+  IcpLast = ICP_TCNT;
+  IcpWraps = 0;
+  ICP_TIFR = _BV(ICP_ICF) | _BV(ICP_TOV);
+  ICP_TIMSK = _BV(ICP_ICIE) | _BV(ICP_TOIE);
+  interrupts();
+}
+
+void stop_Capture()
+{
+  ICP_TIMSK = 0;
+  ResetFrame();
+}
+
+// ***********************************************************************************
+static void AssembleSignals()
+{
+  unsigned long Overflow = EdgeOverflowCount();
+
+  if (Overflow != EdgeOverflow_seen)
+  { // Edges were dropped, the packet under construction is broken
+    if (SlotStalled)
+      RawSlotDropped++; // The ring filled up while all slots were waiting
+    EdgeOverflow_seen = Overflow;
+    ResetFrame();
+  }
+
+  boolean Room = SlotFree();
+
+  while (Room && EdgeTail != EdgeHead)
+  {
+    uint16_t Edge = EdgeRing[EdgeTail];
+    EdgeTail = (EdgeTail + 1) & (EDGE_RING_SIZE - 1);
+    if (AssemblePulse(ICP_TICKS_TO_US(Edge & EDGE_LENGTH_MAX), Edge & EDGE_LEVEL_BIT))
+      Room = SlotFree(); // The plugins are late, the next edges wait in the ring
+  }
+  SlotStall(EdgeTail != EdgeHead);
+
+  // ***   Ending Pulse Check, when the line stays quiet no more edge will come   ***
+  if (!Room || EdgeTail != EdgeHead)
+    return;
+  noInterrupts();
+  uint16_t now = ICP_TCNT;
+  uint16_t last = IcpLast;
+  byte wraps = IcpWraps;
+  interrupts();
+  if (wraps > 1 || (wraps == 1 && now >= last) || ICP_TICKS_TO_US((uint16_t)(now - last)) > SIGNAL_END_TIMEOUT_US)
+    AssembleEnd();
+}
+#elif (defined(ESP32) || defined(ESP8266))
 // ***********************************************************************************
 boolean FetchSignal()
 {
@@ -56,7 +899,7 @@ boolean FetchSignal()
 #define CHECK_TIMEOUT ((millis() - timeStartSeek_ms) < SIGNAL_SEEK_TIMEOUT_MS)
 #define GET_PULSELENGTH PulseLength_us = micros() - timeStartLoop_us
 #define SWITCH_TOGGLE Toggle = !Toggle
-#define STORE_PULSE RawSignal.Pulses[RawCodeLength++] = PulseLength_us / RAWSIGNAL_SAMPLE_RATE
+#define STORE_PULSE RawSignal.Pulses[RawCodeLength++] = PULSE_US(PulseLength_us)
 
   // ***   Init Vars   ***
   Toggle = true;
@@ -128,6 +971,10 @@ boolean FetchSignal()
     RawSignal.Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
     RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
     RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+#if SIGNAL_HASH_SLOTS > 0
+    RawSignal.Hash = HashSignal(RawSignal);
+#endif
+    ClusterSignal(RawSignal);
     //Serial.print ("D");
     //Serial.print (RawCodeLength);
     return true;
@@ -142,7 +989,7 @@ boolean FetchSignal()
 #endif
 // ***********************************************************************************
 
-#if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
+#if ((defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__)) && !defined(RF_ICP_ENABLED))
 // ***********************************************************************************
 boolean FetchSignal()
 {
@@ -180,6 +1027,8 @@ boolean FetchSignal()
   static unsigned int RawCodeLength; // Now unsigned
   static boolean Ftoggle;
   static unsigned long numloops;
+  static unsigned long GlitchCarry;
+  static byte Glitches;
 
   if ((*portInputRegister(Fport) & Fbit) == FstateMask)
   { // If there is a signal
@@ -208,6 +1057,8 @@ boolean FetchSignal()
 
     RawCodeLength = 1U; // Start at 1 for legacy reasons. Element 0 can be used to pass special information like plugin number etc.
     Ftoggle = false;
+    GlitchCarry = 0;
+    Glitches = 0;
     do
     { // Read the pulses in microseconds and place them in temporary buffer RawSignal
       numloops = 0UL;
@@ -217,11 +1068,20 @@ boolean FetchSignal()
           break; // timeout
       }
 
-      PulseLength = ((numloops + Overhead) * 1000UL) / LoopsPerMilli; // Contains pulselength in microseconds
+      PulseLength = ((numloops + Overhead) * 1000UL) / LoopsPerMilli + GlitchCarry; // Contains pulselength in microseconds
+      GlitchCarry = 0;
       if (PulseLength < MIN_PULSE_LENGTH_US)
-        break; // Pulse length too short
+      {
+        if (RawCodeLength <= 2 || Glitches >= SIGNAL_GLITCH_BUDGET)
+          break; // Pulse length too short
+        Glitches++; // Fold it and the previous pulse into the next one
+        GlitchFolded++;
+        GlitchCarry = PULSE_TO_US(RawSignal.Pulses[--RawCodeLength]) + PulseLength;
+        Ftoggle = !Ftoggle;
+        continue;
+      }
       Ftoggle = !Ftoggle;
-      RawSignal.Pulses[RawCodeLength++] = PulseLength / (unsigned long)(RAWSIGNAL_SAMPLE_RATE); // store in RawSignal !!!!
+      RawSignal.Pulses[RawCodeLength++] = PULSE_US(PulseLength); // store in RawSignal !!!!
     } while (RawCodeLength < RAW_BUFFER_SIZE && numloops <= maxloops);                          // For as long as there is space in the buffer, no timeout etc.
     if (RawCodeLength >= MIN_RAW_PULSES)
     {
@@ -230,6 +1090,12 @@ boolean FetchSignal()
       RawSignal.Number = RawCodeLength - 1;       // Number of received pulse times (pulsen *2)
       RawSignal.Pulses[RawSignal.Number + 1] = 0; // Last element contains the timeout.
       RawSignal.Time = millis();                  // Time the RF packet was received (to keep track of retransmits
+#if SIGNAL_HASH_SLOTS > 0
+      RawSignal.Hash = HashSignal(RawSignal);     // Retransmit hash, after the timing loop
+#endif
+      ClusterSignal(RawSignal);                   // Timing clusters and symbols for the plugins
+      if (Glitches)
+        GlitchRescued++;
       return true;
     }
     else
@@ -244,6 +1110,44 @@ boolean FetchSignal()
 #endif
 // ***********************************************************************************
 
+#ifndef RF_BUFFERED_CAPTURE
+// Polled capture, nothing runs in the background
+void start_Capture() {}
+void stop_Capture() {}
+#endif
+
+void display_Capture_Stats()
+{
+#ifdef RF_BUFFERED_CAPTURE
+  display_STAT(PSTR("SLOTS"), RAW_SLOTS);
+  display_STAT(PSTR("QUEUED"), RawSlotsQueued());
+  display_STAT(PSTR("DROPPED"), RawSlotDropped);
+#endif
+#if (defined(RF_ISR_ENABLED) || defined(RF_ICP_ENABLED))
+  display_STAT(PSTR("EDGE_OVERFLOW"), EdgeOverflowCount());
+#endif
+  display_STAT(PSTR("GLITCHES"), GlitchFolded);
+  display_STAT(PSTR("RESCUED"), GlitchRescued);
+}
+
+void reset_Capture_Stats()
+{
+#ifdef RF_BUFFERED_CAPTURE
+  lock_Capture(true);
+  RawSlotDropped = 0;
+#endif
+#if (defined(RF_ISR_ENABLED) || defined(RF_ICP_ENABLED))
+  noInterrupts();
+  EdgeOverflow = EdgeOverflow_seen = 0; // no edge was lost since
+  interrupts();
+#endif
+  GlitchFolded = 0;
+  GlitchRescued = 0;
+#ifdef RF_BUFFERED_CAPTURE
+  lock_Capture(false);
+#endif
+}
+
 /*********************************************************************************************/
 /*
   // RFLink Board specific: Generate a short pulse to switch the Aurel Transceiver from TX to RX mode.
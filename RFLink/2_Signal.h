@@ -9,28 +9,124 @@
 #define Signal_h
 
 #include <Arduino.h>
+#include "RFLink.h"
 
 #define RAW_BUFFER_SIZE 292        // 292        // Maximum number of pulses that is received in one go.
 #define MIN_RAW_PULSES 36          // 36         // Minimal number of bits that need to have been received before we spend CPU time on decoding the signal.
-#define RAWSIGNAL_SAMPLE_RATE 32   // 32         // =8 bits. Sample width / resolution in uSec for raw RF pulses.
 #define SIGNAL_SEEK_TIMEOUT_MS 25  // 25         // After this time in mSec, RF signal will be considered absent.
 #define SIGNAL_MIN_PREAMBLE_US 400 // 400        // After this time in uSec, a RF signal will be considered to have started.
 #define MIN_PULSE_LENGTH_US 100    // 100        // Pulses shorter than this value in uSec. will be seen as garbage and not taken as actual pulses.
+#define SIGNAL_GLITCH_BUDGET 2     // 2          // Garbage pulses per packet that are folded into their neighbours instead of ending the packet. 0 = off.
 #define SIGNAL_END_TIMEOUT_US 5000 // 5000       // After this time in uSec, the RF signal will be considered to have stopped.
 #define SIGNAL_REPEAT_TIME_MS 250  // 500        // Time in mSec. in which the same RF signal should not be accepted again. Filters out retransmits.
+#define SIGNAL_HASH_SLOTS 4        // 4          // Hashes of recent decoded packets kept to drop retransmits before the plugins run. 0 = off.
+#define SIGNAL_HASH_QUANTUM_US 128 // 128        // Pulse step of the retransmit hash, repeats match when their pulses fall in the same steps.
 #define SCAN_HIGH_TIME_MS 50       // 50         // time interval in ms. fast processing for background tasks
 
+#if (defined(ESP32) || defined(ESP8266))
+#define RF_ISR_ENABLED             // Capture RF edges from a GPIO interrupt instead of busy polling the RX pin
+#define EDGE_RING_SIZE 512         // 512        // Edges buffered between the RX interrupt and FetchSignal(). Must be a power of 2.
+#endif
+
+#ifdef ESP32
+// #define RF_RMT_ENABLED          // Time RF pulses with the RMT peripheral, replaces the RX interrupt capture
+#define RMT_RX_CHANNEL 4           // 4          // RMT channel used for receiving. Owns the memory blocks of the next channels too.
+#define RMT_RX_MEM_BLOCKS 4        // 4          // 64 items (128 pulses) per block. A packet must fit, channel + blocks <= 8.
+#endif
+
+#ifdef RF_RMT_ENABLED
+#undef RF_ISR_ENABLED
+#endif
+
+#if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
+// #define RF_ICP_ENABLED          // Time RF pulses with the timer input capture instead of counting loops. RX data on D8 (Mega: D48)
+#define EDGE_RING_SIZE 64          // 64         // Edges buffered between the capture interrupt and FetchSignal(). Must be a power of 2, max 256.
+#define ICP_PRESCALER 8            // Timer clock is F_CPU / 8 (CS11, Mega CS51): 0.5 uSec at 16 MHz, one wrap every 32 mSec
+#endif
+
+#if (defined(RF_ISR_ENABLED) || defined(RF_RMT_ENABLED) || defined(RF_ICP_ENABLED))
+#define RF_BUFFERED_CAPTURE        // Pulses are timed in the background, FetchSignal() only assembles them
+#ifdef RF_ICP_ENABLED
+#define RAW_SLOTS 2                // 2          // Captured packets waiting for the plugins. While all are full the edges (RMT frames) wait in their ring.
+#else
+#define RAW_SLOTS 4                // 4          // Captured packets waiting for the plugins. While all are full the edges (RMT frames) wait in their ring.
+#endif
+#define SIGNAL_SEGMENT_GAP_US 2500 // 2500       // A space this long (and twice the longest pulse of the frame) ends a frame. Comment out to disable.
+#define SIGNAL_MIN_SEGMENT 26      // 26         // Pulses, gap included, a frame needs before a gap splits it from the next one.
+#endif
+
+#if (defined(RF_TASKS_ENABLED) && !defined(RF_BUFFERED_CAPTURE))
+#error "RF_TASKS_ENABLED needs RF_ISR_ENABLED or RF_RMT_ENABLED"
+#endif
+
+// Pulse codec: how RawSignal.Pulses[] stores a duration. Select one.
+#define RAW_PULSE_8BIT             // Linear byte, RAWSIGNAL_SAMPLE_RATE uSec steps, 8160 uSec max.
+// #define RAW_PULSE_16BIT         // Linear 16 bit, 1 uSec steps, 65535 uSec max. Doubles RawSignal size.
+// #define RAW_PULSE_LOG8          // Log byte, 8 uSec steps up to 512 uSec then ~3% steps, 32256 uSec max. Needs a 512 bytes table.
+
+#if defined(RAW_PULSE_16BIT)
+typedef uint16_t RawPulse;
+#define RAWSIGNAL_SAMPLE_RATE 1    // 1          // Sample width / resolution in uSec for raw RF pulses.
+#define RAW_PULSE_MAX 0xFFFFUL
+#elif defined(RAW_PULSE_LOG8)
+typedef byte RawPulse;
+#define RAWSIGNAL_SAMPLE_RATE 8    // 8          // Resolution in uSec of the linear part (up to 512 uSec), doubles every 32 steps after that.
+#define RAW_PULSE_MAX 255UL
+extern const uint16_t PulseLog8_us[256]; // PROGMEM, decoded length of each log code
+#else
+typedef byte RawPulse;
+#define RAWSIGNAL_SAMPLE_RATE 32   // 32         // =8 bits. Sample width / resolution in uSec for raw RF pulses.
+#define RAW_PULSE_MAX 255UL
+#endif
+
+// PULSE_US(us) gives the stored value of a duration, use it for thresholds: Pulses[x] > PULSE_US(650)
+// PULSE_TO_US(p) gives the duration in uSec of a stored value
+#if defined(RAW_PULSE_LOG8)
+constexpr RawPulse PulseLog8(unsigned long steps, byte shift)
+{ // 32..63 steps per octave, shift is the octave above the linear part
+  return (steps < 64) ? shift * 32 + steps : ((shift == 6) ? RAW_PULSE_MAX : PulseLog8(steps >> 1, shift + 1));
+}
+#define PULSE_US(us) PulseLog8((us) / RAWSIGNAL_SAMPLE_RATE, 0)
+#define PULSE_TO_US(p) ((unsigned long)pgm_read_word(&PulseLog8_us[(p)]))
+#else
+constexpr RawPulse PulseLinear(unsigned long steps)
+{
+  return (steps > RAW_PULSE_MAX) ? RAW_PULSE_MAX : steps;
+}
+#define PULSE_US(us) PulseLinear((us) / RAWSIGNAL_SAMPLE_RATE)
+#define PULSE_TO_US(p) ((unsigned long)(p) * RAWSIGNAL_SAMPLE_RATE)
+#endif
+
+// Pulse clustering: after capture the pulse lengths are grouped into at most SIGNAL_CLUSTERS timing
+// classes (short, long, sync, gap...). Decoders can compare cluster symbols instead of raw timings.
+#if (defined(ESP32) || defined(ESP8266))
+#define SIGNAL_CLUSTERING          // Keep clusters and symbols with each packet, 79 bytes (83 in 16 bit) per RawSignal copy. Off on AVR to save RAM
+#endif
+#define SIGNAL_CLUSTERS 4          // 4          // Fixed, a symbol is stored in 2 bits
+#define SIGNAL_CLUSTER_SPREAD 4    // 4          // A pulse within 1/4 of a cluster mean joins that cluster
+
 struct RawSignalStruct // Raw signal variabelen places in a struct
 {
-  int Number;                       // Number of pulses, times two as every pulse has a mark and a space.
-  byte Repeats;                     // Number of re-transmits on transmit actions.
-  byte Delay;                       // Delay in ms. after transmit of a single RF pulse packet
-  byte Multiply;                    // Pulses[] * Multiply is the real pulse time in microseconds
-  unsigned long Time;               // Timestamp indicating when the signal was received (millis())
-  byte Pulses[RAW_BUFFER_SIZE + 1]; // Table with the measured pulses in microseconds divided by RawSignal.Multiply. (halves RAM usage)
+  int Number;                           // Number of pulses, times two as every pulse has a mark and a space.
+  byte Repeats;                         // Number of re-transmits on transmit actions.
+  byte Delay;                           // Delay in ms. after transmit of a single RF pulse packet
+  byte Multiply;                        // Pulses[] * Multiply is the real pulse time in microseconds (linear codecs)
+  unsigned long Time;                   // Timestamp indicating when the signal was received (millis())
+  RawPulse Pulses[RAW_BUFFER_SIZE + 1]; // Table with the measured pulses, see PULSE_US(). (a byte halves RAM usage)
   // First pulse is located in element 1. Element 0 is used for special purposes, like signalling the use of a specific plugin
+#ifdef SIGNAL_CLUSTERING
+  byte Clusters;                             // Number of timing clusters found by ClusterSignal(), 0 if not clustered
+  RawPulse Centroid[SIGNAL_CLUSTERS];        // Mean pulse length of each cluster, shortest first
+  byte Symbols[(RAW_BUFFER_SIZE + 4) / 4];   // Cluster of each pulse, 2 bits per pulse, see PULSE_SYMBOL()
+#endif
+  unsigned long Hash;                        // Hash of the quantized pulses taken during capture, equal for exact repeats, 0 if none
 };
 
+#ifdef SIGNAL_CLUSTERING
+// PULSE_SYMBOL(x) gives the cluster (0 = shortest) of RawSignal.Pulses[x]
+#define PULSE_SYMBOL(x) ((RawSignal.Symbols[(x) >> 2] >> (((x)&3) << 1)) & 3)
+#endif
+
 extern RawSignalStruct RawSignal;
 extern unsigned long SignalCRC;   // holds the bitstream value for some plugins to identify RF repeats
 extern unsigned long SignalCRC_1; // holds the previous SignalCRC (for mixed burst protocols)
@@ -39,7 +135,34 @@ extern byte SignalHashPrevious;   // holds the last processed plugin number
 extern unsigned long RepeatingTimer;
 
 boolean FetchSignal();
+#ifdef SIGNAL_CLUSTERING
+void ClusterSignal(RawSignalStruct &Signal);
+byte SymbolAbove(RawPulse Threshold);
+#else
+inline void ClusterSignal(RawSignalStruct &) {} // nothing is stored, PacketView thresholds the pulses
+#endif
 boolean ScanEvent(void);
+void start_Capture();
+void stop_Capture();
+extern unsigned long GlitchFolded;  // pulses shorter than MIN_PULSE_LENGTH_US folded into their neighbours
+extern unsigned long GlitchRescued; // packets received thanks to folding
+extern unsigned long RepeatsDropped; // retransmits dropped before the plugins, see SIGNAL_HASH_SLOTS
+#if (defined(RF_ISR_ENABLED) || defined(RF_ICP_ENABLED))
+extern volatile unsigned long EdgeOverflow; // edges lost because FetchSignal() could not keep up
+#endif
+#ifdef RF_BUFFERED_CAPTURE
+extern unsigned long RawSlotDropped; // waits of the assembler for a free RawSignal slot, and edge overflows during them
+byte RawSlotsQueued();
+#endif
+void display_Capture_Stats();
+void reset_Capture_Stats();
+#ifdef RF_ICP_ENABLED
+uint16_t read_Capture_Timer(); // free running count of the capture timer, ICP_PRESCALER CPU cycles per tick
+#endif
+#ifdef RF_TASKS_ENABLED
+extern TaskHandle_t CaptureTaskHandle;
+void start_CaptureTask();
+#endif
 // void RFLinkHW(void);
 // void RawSendRF(void);
 
@@ -8,6 +8,7 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "1_Radio.h"
+#include "2_Signal.h"
 #include "3_Serial.h"
 #include "4_Display.h"
 #include "5_Plugin.h"
@@ -196,6 +197,68 @@ boolean CheckCmd()
           display_Footer();
         }
       }
+#ifdef PLUGIN_MULTI_MATCH
+      else if (strncasecmp(InputBuffer_Serial + 3, "MULTIMATCH=O", 12) == 0)
+      {
+        MultiMatch = (InputBuffer_Serial[15] == 'N' || InputBuffer_Serial[15] == 'n');
+        display_Header();
+        display_Name(MultiMatch ? PSTR("MULTIMATCH=ON") : PSTR("MULTIMATCH=OFF"));
+        display_Footer();
+      }
+#endif
+      else if (strncasecmp(InputBuffer_Serial + 3, "STATS;RESET;", 12) == 0)
+      {
+        reset_Capture_Stats();
+        reset_Decode_Stats();
+        ValidCommand = 1;
+      }
+      else if (strncasecmp(InputBuffer_Serial + 3, "STATS;", 6) == 0)
+      {
+        display_Header();
+        display_Name(PSTR("STATS"));
+        display_Capture_Stats();
+        display_Footer();
+        sendMsg();
+        display_Header();
+        display_Name(PSTR("STATS"));
+        display_Decode_Stats();
+        display_Footer();
+#if (defined(ESP32) || defined(ESP8266))
+        sendMsg();
+        display_Header();
+        display_Name(PSTR("STATS"));
+        display_Heap_Stats();
+        display_Footer();
+#endif
+      }
+      else if (strncasecmp(InputBuffer_Serial + 3, "PLUGIN=", 7) == 0)
+      { // 10;PLUGIN=04;OFF;
+        char *Next;
+        long Id = strtol(InputBuffer_Serial + 10, &Next, 10);
+        boolean On = (strncasecmp(Next, ";ON;", 4) == 0);
+
+        if (Id > 0 && Id < 256 && (On || strncasecmp(Next, ";OFF;", 5) == 0) && PluginSwitch(Id, On))
+          display_Plugin_State(Id);
+        else
+          ValidCommand = 2;
+      }
+      else if (strncasecmp(InputBuffer_Serial + 3, "PLUGINS;", 8) == 0)
+      {
+        display_Plugin_States();
+      }
+      else if (strncasecmp(InputBuffer_Serial + 3, "ORDER;", 6) == 0)
+      {
+        display_Plugin_Order();
+      }
+#ifdef RF_TASKS_ENABLED
+      else if (strncasecmp(InputBuffer_Serial + 3, "TASKS;", 6) == 0)
+      {
+        display_Header();
+        display_Name(PSTR("TASKS"));
+        display_Task_Stats();
+        display_Footer();
+      }
+#endif
       else if (strncasecmp(InputBuffer_Serial + 3, "VERSION", 7) == 0)
       {
         display_Header();
@@ -10,9 +10,9 @@
 #include "3_Serial.h"
 #include "4_Display.h"
 
-byte PKSequenceNumber = 0;       // 1 byte packet counter
-char dbuffer[30];                // Buffer for message chunk data
-char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
+byte PKSequenceNumber = 0;                     // 1 byte packet counter
+char pbuffer[PRINT_BUFFER_SIZE];               // Buffer for complete message data
+DisplayLine Display(pbuffer, PKSequenceNumber); // display_*() write to pbuffer
 
 // ------------------- //
 // Display shared func //
@@ -23,330 +23,338 @@ char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
 #endif
 
 // Common Header
-void display_Header(void)
+void DisplayLine::Header(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%02X"), PSTR("20;"), PKSequenceNumber++);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%02X"), PSTR("20;"), Sequence++);
+  strcat(Line, Chunk);
 }
 
 // Plugin Name
-void display_Name(const char *input)
+void DisplayLine::Name(const char *input)
 {
-  sprintf_P(dbuffer, PSTR(";%s"), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR(";%s"), input);
+  strcat(Line, Chunk);
 }
 
 // Common Footer
-void display_Footer(void)
+void DisplayLine::Footer(void)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";\r\n"));
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s"), PSTR(";\r\n"));
+  strcat(Line, Chunk);
 }
 
 // Start message
-void display_Splash(void)
+void DisplayLine::Splash(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%d.%d"), PSTR(";RFLink_ESP;VER="), BUILDNR, REVNR);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%d.%d"), PSTR(";RFLink_ESP;VER="), BUILDNR, REVNR);
+  strcat(Line, Chunk);
 }
 
 // ID=9999 => device ID (often a rolling code and/or device channel number) (Hexadecimal)
-void display_IDn(unsigned long input, byte n)
+void DisplayLine::IDn(unsigned long input, byte n)
 {
   switch (n)
   {
   case 2:
-    sprintf_P(dbuffer, PSTR("%s%02lx"), PSTR(";ID="), input);
+    sprintf_P(Chunk, PSTR("%s%02lx"), PSTR(";ID="), input);
     break;
   case 4:
-    sprintf_P(dbuffer, PSTR("%s%04lx"), PSTR(";ID="), input);
+    sprintf_P(Chunk, PSTR("%s%04lx"), PSTR(";ID="), input);
     break;
   case 6:
-    sprintf_P(dbuffer, PSTR("%s%06lx"), PSTR(";ID="), input);
+    sprintf_P(Chunk, PSTR("%s%06lx"), PSTR(";ID="), input);
     break;
   case 8:
   default:
-    sprintf_P(dbuffer, PSTR("%s%08lx"), PSTR(";ID="), input);
+    sprintf_P(Chunk, PSTR("%s%08lx"), PSTR(";ID="), input);
   }
-  strcat(pbuffer, dbuffer);
+  strcat(Line, Chunk);
 }
 
-void display_IDc(const char *input)
+void DisplayLine::IDc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";ID="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  sprintf_P(Chunk, PSTR("%s"), PSTR(";ID="));
+  strcat(Line, Chunk);
+  strcat(Line, input);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
-void display_SWITCH(byte input)
+void DisplayLine::SWITCH(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";SWITCH="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%02x"), PSTR(";SWITCH="), input);
+  strcat(Line, Chunk);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
-void display_SWITCHc(const char *input)
+void DisplayLine::SWITCHc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";SWITCH="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  sprintf_P(Chunk, PSTR("%s"), PSTR(";SWITCH="));
+  strcat(Line, Chunk);
+  strcat(Line, input);
 }
 
 // CMD=ON => Command (ON/OFF/ALLON/ALLOFF) Additional for Milight: DISCO+/DISCO-/MODE0 - MODE8
-void display_CMD(boolean all, byte on)
+void DisplayLine::CMD(boolean all, byte on)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";CMD="));
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s"), PSTR(";CMD="));
+  strcat(Line, Chunk);
 
   if (all == CMD_All)
   {
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ALL"));
-    strcat(pbuffer, dbuffer);
+    sprintf_P(Chunk, PSTR("%s"), PSTR("ALL"));
+    strcat(Line, Chunk);
   }
 
   switch (on)
   {
   case CMD_On:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ON"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR("ON"));
     break;
   case CMD_Off:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("OFF"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR("OFF"));
     break;
   case CMD_Bright:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("BRIGHT"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR("BRIGHT"));
     break;
   case CMD_Dim:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("DIM"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR("DIM"));
     break;
   case CMD_Unknown:
   default:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("UNKNOWN"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR("UNKNOWN"));
   }
-  strcat(pbuffer, dbuffer);
+  strcat(Line, Chunk);
 }
 
 // SET_LEVEL=15 => Direct dimming level setting value (decimal value: 0-15)
-void display_SET_LEVEL(byte input)
+void DisplayLine::SET_LEVEL(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";SET_LEVEL="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%02d"), PSTR(";SET_LEVEL="), input);
+  strcat(Line, Chunk);
 }
 
 // TEMP=9999 => Temperature celcius (hexadecimal), high bit contains negative sign, needs division by 10
-void display_TEMP(unsigned int input)
+void DisplayLine::TEMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";TEMP="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";TEMP="), input);
+  strcat(Line, Chunk);
 }
 
 // HUM=99 => Humidity (decimal value: 0-100 to indicate relative humidity in %)
-void display_HUM(byte input, boolean bcd)
+void DisplayLine::HUM(byte input, boolean bcd)
 {
   if (bcd == HUM_BCD)
-    sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HUM="), input);
+    sprintf_P(Chunk, PSTR("%s%02x"), PSTR(";HUM="), input);
   else
-    sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";HUM="), input);
-  strcat(pbuffer, dbuffer);
+    sprintf_P(Chunk, PSTR("%s%02d"), PSTR(";HUM="), input);
+  strcat(Line, Chunk);
 }
 
 // BARO=9999 => Barometric pressure (hexadecimal)
-void display_BARO(unsigned int input)
+void DisplayLine::BARO(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";BARO="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";BARO="), input);
+  strcat(Line, Chunk);
 }
 
 // HSTATUS=99 => 0=Normal, 1=Comfortable, 2=Dry, 3=Wet
-void display_HSTATUS(byte input)
+void DisplayLine::HSTATUS(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HSTATUS="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%02x"), PSTR(";HSTATUS="), input);
+  strcat(Line, Chunk);
 }
 
 // BFORECAST=99 => 0=No Info/Unknown, 1=Sunny, 2=Partly Cloudy, 3=Cloudy, 4=Rain
-void display_BFORECAST(byte input)
+void DisplayLine::BFORECAST(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";BFORECAST="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%02x"), PSTR(";BFORECAST="), input);
+  strcat(Line, Chunk);
 }
 
 // UV=9999 => UV intensity (hexadecimal)
-void display_UV(unsigned int input)
+void DisplayLine::UV(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";UV="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";UV="), input);
+  strcat(Line, Chunk);
 }
 
 // LUX=9999 => Light intensity (hexadecimal)
-void display_LUX(unsigned int input)
+void DisplayLine::LUX(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";LUX="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";LUX="), input);
+  strcat(Line, Chunk);
 }
 
 // BAT=OK => Battery status indicator (OK/LOW)
-void display_BAT(boolean input)
+void DisplayLine::BAT(boolean input)
 {
   if (input == true)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=OK"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";BAT=OK"));
   else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=LOW"));
-  strcat(pbuffer, dbuffer);
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";BAT=LOW"));
+  strcat(Line, Chunk);
 }
 
 // RAIN=1234 => Total rain in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
-void display_RAIN(unsigned int input)
+void DisplayLine::RAIN(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAIN="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";RAIN="), input);
+  strcat(Line, Chunk);
 }
 
 // RAINRATE=1234 => Rain rate in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
-void display_RAINRATE(unsigned int input)
+void DisplayLine::RAINRATE(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAINRATE="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";RAINRATE="), input);
+  strcat(Line, Chunk);
 }
 
 // WINSP=9999 => Wind speed in km. p/h (hexadecimal) needs division by 10
-void display_WINSP(unsigned int input)
+void DisplayLine::WINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINSP="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";WINSP="), input);
+  strcat(Line, Chunk);
 }
 
 // AWINSP=9999 => Average Wind speed in km. p/h (hexadecimal) needs division by 10
-void display_AWINSP(unsigned int input)
+void DisplayLine::AWINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";AWINSP="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";AWINSP="), input);
+  strcat(Line, Chunk);
 }
 
 // WINGS=9999 => Wind Gust in km. p/h (hexadecimal)
-void display_WINGS(unsigned int input)
+void DisplayLine::WINGS(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINGS="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";WINGS="), input);
+  strcat(Line, Chunk);
 }
 
 // WINDIR=123 => Wind direction (integer value from 0-15) reflecting 0-360 degrees in 22.5 degree steps
-void display_WINDIR(unsigned int input)
+void DisplayLine::WINDIR(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";WINDIR="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%03d"), PSTR(";WINDIR="), input);
+  strcat(Line, Chunk);
 }
 
 // WINCHL => wind chill (hexadecimal, see TEMP)
-void display_WINCHL(unsigned int input)
+void DisplayLine::WINCHL(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINCHL="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";WINCHL="), input);
+  strcat(Line, Chunk);
 }
 
 // WINTMP=1234 => Wind meter temperature reading (hexadecimal, see TEMP)
-void display_WINTMP(unsigned int input)
+void DisplayLine::WINTMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINTMP="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";WINTMP="), input);
+  strcat(Line, Chunk);
 }
 
 // CHIME=123 => Chime/Doorbell melody number
-void display_CHIME(unsigned int input)
+void DisplayLine::CHIME(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";CHIME="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%03d"), PSTR(";CHIME="), input);
+  strcat(Line, Chunk);
 }
 
 // SMOKEALERT=ON => ON/OFF
-void display_SMOKEALERT(boolean input)
+void DisplayLine::SMOKEALERT(boolean input)
 {
   if (input == SMOKE_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=ON"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";SMOKEALERT=ON"));
   else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=OFF"));
-  strcat(pbuffer, dbuffer);
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";SMOKEALERT=OFF"));
+  strcat(Line, Chunk);
 }
 
 // PIR=ON => ON/OFF
-void display_PIR(boolean input)
+void DisplayLine::PIR(boolean input)
 {
   if (input == PIR_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=ON"));
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";PIR=ON"));
   else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=OFF"));
-  strcat(pbuffer, dbuffer);
+    sprintf_P(Chunk, PSTR("%s"), PSTR(";PIR=OFF"));
+  strcat(Line, Chunk);
 }
 
 // CO2=1234 => CO2 air quality
-void display_CO2(unsigned int input)
+void DisplayLine::CO2(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CO2="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";CO2="), input);
+  strcat(Line, Chunk);
 }
 
 // SOUND=1234 => Noise level
-void display_SOUND(unsigned int input)
+void DisplayLine::SOUND(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";SOUND="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";SOUND="), input);
+  strcat(Line, Chunk);
 }
 
 // KWATT=9999 => KWatt (hexadecimal)
-void display_KWATT(unsigned int input)
+void DisplayLine::KWATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";KWATT="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";KWATT="), input);
+  strcat(Line, Chunk);
 }
 
 // WATT=9999 => Watt (hexadecimal)
-void display_WATT(unsigned int input)
+void DisplayLine::WATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WATT="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";WATT="), input);
+  strcat(Line, Chunk);
 }
 
 // CURRENT=1234 => Current phase 1
-void display_CURRENT(unsigned int input)
+void DisplayLine::CURRENT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CURRENT="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";CURRENT="), input);
+  strcat(Line, Chunk);
 }
 
 // DIST=1234 => Distance
-void display_DIST(unsigned int input)
+void DisplayLine::DIST(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";DIST="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";DIST="), input);
+  strcat(Line, Chunk);
 }
 
 // METER=1234 => Meter values (water/electricity etc.)
-void display_METER(unsigned int input)
+void DisplayLine::METER(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";METER="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";METER="), input);
+  strcat(Line, Chunk);
 }
 
 // VOLT=1234 => Voltage
-void display_VOLT(unsigned int input)
+void DisplayLine::VOLT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";VOLT="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04d"), PSTR(";VOLT="), input);
+  strcat(Line, Chunk);
 }
 
 // RGBW=9999 => Milight: provides 1 byte color and 1 byte brightness value
-void display_RGBW(unsigned int input)
+void DisplayLine::RGBW(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RGBW="), input);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";RGBW="), input);
+  strcat(Line, Chunk);
 }
 
 
 // Channel
-void display_CHAN(byte channel)
+void DisplayLine::CHAN(byte channel)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";CHN="), channel);
-  strcat(pbuffer, dbuffer);
+  sprintf_P(Chunk, PSTR("%s%04x"), PSTR(";CHN="), channel);
+  strcat(Line, Chunk);
+}
+
+// NAME=1234 => Diagnostic counter (decimal)
+void DisplayLine::STAT(const char *name, unsigned long input)
+{
+  sprintf_P(Chunk, PSTR(";%s=%lu"), name, input);
+  if (strlen(Line) + strlen(Chunk) < PRINT_BUFFER_SIZE - 4) // room left for the footer
+    strcat(Line, Chunk);
 }
 
 // --------------------- //
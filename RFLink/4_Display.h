@@ -12,18 +12,9 @@
 
 #define PRINT_BUFFER_SIZE 90 // 90         // Maximum number of characters that a command should print in one go via the print buffer.
 
-// extern byte PKSequenceNumber;     // 1 byte packet counter
+extern byte PKSequenceNumber;           // 1 byte packet counter
 extern char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for printing data
 
-void display_Header(void);
-void display_Name(const char *);
-void display_Footer(void);
-void display_Splash(void);
-void display_IDn(unsigned long, byte);
-void display_IDc(const char *);
-void display_SWITCH(byte);
-void display_SWITCHc(const char *);
-void display_CHAN(byte);
 enum CMD_Group
 {
     CMD_Single,
@@ -37,51 +28,118 @@ enum CMD_OnOff
     CMD_Dim,
     CMD_Unknown
 };
-void display_CMD(boolean, byte);
-void display_SET_LEVEL(byte);
-void display_TEMP(unsigned int);
 enum HUM_Type
 {
     HUM_HEX,
     HUM_BCD
 };
-void display_HUM(byte, boolean);
-void display_BARO(unsigned int);
-void display_HSTATUS(byte);
-void display_BFORECAST(byte);
-void display_UV(unsigned int);
-void display_LUX(unsigned int);
-void display_BAT(boolean);
-void display_RAIN(unsigned int);
-void display_RAINRATE(unsigned int);
-void display_WINSP(unsigned int);
-void display_AWINSP(unsigned int);
-void display_WINGS(unsigned int);
-void display_WINDIR(unsigned int);
-void display_WINCHL(unsigned int);
-void display_WINTMP(unsigned int);
-void display_CHIME(unsigned int);
 enum SMOKE_OnOff
 {
     SMOKE_Off,
     SMOKE_On
 };
-void display_SMOKEALERT(boolean);
 enum PIR_OnOff
 {
     PIR_Off,
     PIR_On
 };
-void display_PIR(boolean);
-void display_CO2(unsigned int);
-void display_SOUND(unsigned int);
-void display_KWATT(unsigned int);
-void display_WATT(unsigned int);
-void display_CURRENT(unsigned int);
-void display_DIST(unsigned int);
-void display_METER(unsigned int);
-void display_VOLT(unsigned int);
-void display_RGBW(unsigned int);
+
+class DisplayLine // Builds one 20;XX;..; line in Line, which holds PRINT_BUFFER_SIZE chars
+{
+public:
+    DisplayLine(char *Buffer, byte &Sequence) : Line(Buffer), Sequence(Sequence) {}
+
+    void Header(void);
+    void Name(const char *);
+    void Footer(void);
+    void Splash(void);
+    void IDn(unsigned long, byte);
+    void IDc(const char *);
+    void SWITCH(byte);
+    void SWITCHc(const char *);
+    void CHAN(byte);
+    void CMD(boolean, byte);
+    void SET_LEVEL(byte);
+    void TEMP(unsigned int);
+    void HUM(byte, boolean);
+    void BARO(unsigned int);
+    void HSTATUS(byte);
+    void BFORECAST(byte);
+    void UV(unsigned int);
+    void LUX(unsigned int);
+    void BAT(boolean);
+    void RAIN(unsigned int);
+    void RAINRATE(unsigned int);
+    void WINSP(unsigned int);
+    void AWINSP(unsigned int);
+    void WINGS(unsigned int);
+    void WINDIR(unsigned int);
+    void WINCHL(unsigned int);
+    void WINTMP(unsigned int);
+    void CHIME(unsigned int);
+    void SMOKEALERT(boolean);
+    void PIR(boolean);
+    void CO2(unsigned int);
+    void SOUND(unsigned int);
+    void KWATT(unsigned int);
+    void WATT(unsigned int);
+    void CURRENT(unsigned int);
+    void DIST(unsigned int);
+    void METER(unsigned int);
+    void VOLT(unsigned int);
+    void RGBW(unsigned int);
+    void STAT(const char *, unsigned long);
+
+    char *Line;
+
+private:
+    byte &Sequence; // packet counter of the 20;XX; header
+    char Chunk[30]; // message chunk data
+};
+
+extern DisplayLine Display; // the line in pbuffer
+
+// The display_*() functions write to pbuffer, see DisplayLine for a line of your own
+inline void display_Header(void) { Display.Header(); }
+inline void display_Name(const char *input) { Display.Name(input); }
+inline void display_Footer(void) { Display.Footer(); }
+inline void display_Splash(void) { Display.Splash(); }
+inline void display_IDn(unsigned long input, byte n) { Display.IDn(input, n); }
+inline void display_IDc(const char *input) { Display.IDc(input); }
+inline void display_SWITCH(byte input) { Display.SWITCH(input); }
+inline void display_SWITCHc(const char *input) { Display.SWITCHc(input); }
+inline void display_CMD(boolean all, byte on) { Display.CMD(all, on); }
+inline void display_SET_LEVEL(byte input) { Display.SET_LEVEL(input); }
+inline void display_TEMP(unsigned int input) { Display.TEMP(input); }
+inline void display_HUM(byte input, boolean bcd) { Display.HUM(input, bcd); }
+inline void display_BARO(unsigned int input) { Display.BARO(input); }
+inline void display_HSTATUS(byte input) { Display.HSTATUS(input); }
+inline void display_BFORECAST(byte input) { Display.BFORECAST(input); }
+inline void display_UV(unsigned int input) { Display.UV(input); }
+inline void display_LUX(unsigned int input) { Display.LUX(input); }
+inline void display_BAT(boolean input) { Display.BAT(input); }
+inline void display_RAIN(unsigned int input) { Display.RAIN(input); }
+inline void display_RAINRATE(unsigned int input) { Display.RAINRATE(input); }
+inline void display_WINSP(unsigned int input) { Display.WINSP(input); }
+inline void display_AWINSP(unsigned int input) { Display.AWINSP(input); }
+inline void display_WINGS(unsigned int input) { Display.WINGS(input); }
+inline void display_WINDIR(unsigned int input) { Display.WINDIR(input); }
+inline void display_WINCHL(unsigned int input) { Display.WINCHL(input); }
+inline void display_WINTMP(unsigned int input) { Display.WINTMP(input); }
+inline void display_CHIME(unsigned int input) { Display.CHIME(input); }
+inline void display_SMOKEALERT(boolean input) { Display.SMOKEALERT(input); }
+inline void display_PIR(boolean input) { Display.PIR(input); }
+inline void display_CO2(unsigned int input) { Display.CO2(input); }
+inline void display_SOUND(unsigned int input) { Display.SOUND(input); }
+inline void display_KWATT(unsigned int input) { Display.KWATT(input); }
+inline void display_WATT(unsigned int input) { Display.WATT(input); }
+inline void display_CURRENT(unsigned int input) { Display.CURRENT(input); }
+inline void display_DIST(unsigned int input) { Display.DIST(input); }
+inline void display_METER(unsigned int input) { Display.METER(input); }
+inline void display_VOLT(unsigned int input) { Display.VOLT(input); }
+inline void display_RGBW(unsigned int input) { Display.RGBW(input); }
+inline void display_CHAN(byte channel) { Display.CHAN(channel); }
+inline void display_STAT(const char *name, unsigned long input) { Display.STAT(name, input); }
 
 void retrieve_Init();
 boolean retrieve_Name(const char *);
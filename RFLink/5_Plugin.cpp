@@ -8,18 +8,28 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "2_Signal.h"
+#include "4_Display.h"
 #include "5_Plugin.h"
-
-boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-byte Plugin_id[PLUGIN_MAX];
-byte Plugin_State[PLUGIN_MAX];
-#ifndef ARDUINO_AVR_UNO // Optimize memory limite to 2048 bytes on arduino uno
-String Plugin_Description[PLUGIN_MAX];
+#ifdef ESP32
+#include <Preferences.h>
+#else
+#include <EEPROM.h>
 #endif
 
-boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, char *); // Trasmit plugins
-byte PluginTX_id[PLUGIN_TX_MAX];
-byte PluginTX_State[PLUGIN_TX_MAX];
+unsigned long PluginPackets = 0L; // packets handed to PluginRXCall()
+unsigned long PluginCalls = 0L;   // receive plugins called for them
+unsigned long PluginFiltered = 0L; // calls saved by the signatures
+#ifdef PLUGIN_SPLITTER
+unsigned long PluginFrames = 0L; // frames cut from long packets by the splitter
+#endif
+#ifdef PLUGIN_COMBINER
+unsigned long PluginRecovered = 0L; // packets decoded from the vote of their repeats
+#endif
+static boolean PluginRecount = false; // PluginCombine() runs the plugins again, the counters and the profiler skip it
+#ifdef PLUGIN_MULTI_MATCH
+boolean MultiMatch = false;          // 10;MULTIMATCH=ON;
+unsigned long PluginAmbiguous = 0L; // frames accepted by more than one plugin
+#endif
 
 boolean RFDebug = RFDebug_0;     // debug RF signals with plugin 001 (no decode)
 boolean QRFDebug = QRFDebug_0;   // debug RF signals with plugin 001 but no multiplication (faster?, compact)
@@ -535,1702 +545,998 @@ boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no mult
 #ifdef PLUGIN_255
 #include "./Plugins/Plugin_255.c"
 #endif
-/*********************************************************************************************/
-void PluginInit(void)
-{
-  byte x;
-
-  // Wis de pointertabel voor de plugins.
-  for (x = 0; x < PLUGIN_MAX; x++)
-  {
-    Plugin_ptr[x] = 0;
-    Plugin_id[x] = 0;
-    Plugin_State[x] = P_Disabled;
-  }
-
-  x = 0;
+/*********************************************************************************************\
+ * Plugin registry, built by the compiler from the PLUGIN_xxx / PLUGIN_TX_xxx selections in
+ * _Plugin_Config_01.h. It lives in flash, only the compiled plugins take an entry.
+ \*********************************************************************************************/
+#ifdef ARDUINO_AVR_UNO // Optimize memory limite to 2048 bytes on arduino uno
+#define PLUGIN_DESC(Desc) NULL
+#else
+#define PLUGIN_DESC(Desc) Desc
+#endif
 
+const PluginEntry Plugins[] PROGMEM = {
 #ifdef PLUGIN_001
-  Plugin_id[x] = 1;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_001;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_001;
+    {1, &Plugin_001, NULL, NULL, NULL, PLUGIN_DESC(Plugin_001_Desc)},
 #endif
-
 #ifdef PLUGIN_002
-  Plugin_id[x] = 2;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_002;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_002;
+    {2, NULL, &Plugin_002, Plugin_002_Pulses, NULL, PLUGIN_DESC(Plugin_002_Desc)},
 #endif
-
 #ifdef PLUGIN_003
-  Plugin_id[x] = 3;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_003;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_003;
+    {3, NULL, &Plugin_003, Plugin_003_Pulses, NULL, PLUGIN_DESC(Plugin_003_Desc)},
 #endif
-
 #ifdef PLUGIN_004
-  Plugin_id[x] = 4;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_004;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_004;
+    {4, NULL, &Plugin_004, Plugin_004_Pulses, &Plugin_004_Signature, PLUGIN_DESC(Plugin_004_Desc)},
 #endif
-
 #ifdef PLUGIN_005
-  Plugin_id[x] = 5;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_005;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_005;
+    {5, NULL, &Plugin_005, Plugin_005_Pulses, NULL, PLUGIN_DESC(Plugin_005_Desc)},
 #endif
-
 #ifdef PLUGIN_006
-  Plugin_id[x] = 6;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_006;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_006;
+    {6, &Plugin_006, NULL, Plugin_006_Pulses, NULL, PLUGIN_DESC(Plugin_006_Desc)},
 #endif
-
 #ifdef PLUGIN_007
-  Plugin_id[x] = 7;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_007;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_007;
+    {7, &Plugin_007, NULL, Plugin_007_Pulses, NULL, PLUGIN_DESC(Plugin_007_Desc)},
 #endif
-
 #ifdef PLUGIN_008
-  Plugin_id[x] = 8;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_008;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_008;
+    {8, &Plugin_008, NULL, Plugin_008_Pulses, NULL, PLUGIN_DESC(Plugin_008_Desc)},
 #endif
-
 #ifdef PLUGIN_009
-  Plugin_id[x] = 9;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_009;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_009;
+    {9, &Plugin_009, NULL, Plugin_009_Pulses, NULL, PLUGIN_DESC(Plugin_009_Desc)},
 #endif
-
 #ifdef PLUGIN_010
-  Plugin_id[x] = 10;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_010;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_010;
+    {10, &Plugin_010, NULL, Plugin_010_Pulses, NULL, PLUGIN_DESC(Plugin_010_Desc)},
 #endif
-
 #ifdef PLUGIN_011
-  Plugin_id[x] = 11;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_011;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_011;
+    {11, NULL, &Plugin_011, Plugin_011_Pulses, NULL, PLUGIN_DESC(Plugin_011_Desc)},
 #endif
-
 #ifdef PLUGIN_012
-  Plugin_id[x] = 12;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_012;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_012;
+    {12, &Plugin_012, NULL, Plugin_012_Pulses, NULL, PLUGIN_DESC(Plugin_012_Desc)},
 #endif
-
 #ifdef PLUGIN_013
-  Plugin_id[x] = 13;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_013;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_013;
+    {13, &Plugin_013, NULL, Plugin_013_Pulses, &Plugin_013_Signature, PLUGIN_DESC(Plugin_013_Desc)},
 #endif
-
 #ifdef PLUGIN_014
-  Plugin_id[x] = 14;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_014;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_014;
+    {14, &Plugin_014, NULL, Plugin_014_Pulses, &Plugin_014_Signature, PLUGIN_DESC(Plugin_014_Desc)},
 #endif
-
 #ifdef PLUGIN_015
-  Plugin_id[x] = 15;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_015;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_015;
+    {15, &Plugin_015, NULL, Plugin_015_Pulses, NULL, PLUGIN_DESC(Plugin_015_Desc)},
 #endif
-
 #ifdef PLUGIN_016
-  Plugin_id[x] = 16;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_016;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_016;
+    {16, &Plugin_016, NULL, NULL, NULL, PLUGIN_DESC(Plugin_016_Desc)},
 #endif
-
 #ifdef PLUGIN_017
-  Plugin_id[x] = 17;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_017;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_017;
+    {17, &Plugin_017, NULL, NULL, NULL, PLUGIN_DESC(Plugin_017_Desc)},
 #endif
-
 #ifdef PLUGIN_018
-  Plugin_id[x] = 18;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_018;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_018;
+    {18, &Plugin_018, NULL, NULL, NULL, PLUGIN_DESC(Plugin_018_Desc)},
 #endif
-
 #ifdef PLUGIN_019
-  Plugin_id[x] = 19;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_019;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_019;
+    {19, &Plugin_019, NULL, NULL, NULL, PLUGIN_DESC(Plugin_019_Desc)},
 #endif
-
 #ifdef PLUGIN_020
-  Plugin_id[x] = 20;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_020;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_020;
+    {20, &Plugin_020, NULL, NULL, NULL, PLUGIN_DESC(Plugin_020_Desc)},
 #endif
-
 #ifdef PLUGIN_021
-  Plugin_id[x] = 21;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_021;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_021;
+    {21, &Plugin_021, NULL, NULL, NULL, PLUGIN_DESC(Plugin_021_Desc)},
 #endif
-
 #ifdef PLUGIN_022
-  Plugin_id[x] = 22;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_022;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_022;
+    {22, &Plugin_022, NULL, NULL, NULL, PLUGIN_DESC(Plugin_022_Desc)},
 #endif
-
 #ifdef PLUGIN_023
-  Plugin_id[x] = 23;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_023;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_023;
+    {23, &Plugin_023, NULL, NULL, NULL, PLUGIN_DESC(Plugin_023_Desc)},
 #endif
-
 #ifdef PLUGIN_024
-  Plugin_id[x] = 24;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_024;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_024;
+    {24, &Plugin_024, NULL, NULL, NULL, PLUGIN_DESC(Plugin_024_Desc)},
 #endif
-
 #ifdef PLUGIN_025
-  Plugin_id[x] = 25;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_025;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_025;
+    {25, &Plugin_025, NULL, NULL, NULL, PLUGIN_DESC(Plugin_025_Desc)},
 #endif
-
 #ifdef PLUGIN_026
-  Plugin_id[x] = 26;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_026;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_026;
+    {26, &Plugin_026, NULL, NULL, NULL, PLUGIN_DESC(Plugin_026_Desc)},
 #endif
-
 #ifdef PLUGIN_027
-  Plugin_id[x] = 27;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_027;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_027;
+    {27, &Plugin_027, NULL, NULL, NULL, PLUGIN_DESC(Plugin_027_Desc)},
 #endif
-
 #ifdef PLUGIN_028
-  Plugin_id[x] = 28;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_028;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_028;
+    {28, &Plugin_028, NULL, NULL, NULL, PLUGIN_DESC(Plugin_028_Desc)},
 #endif
-
 #ifdef PLUGIN_029
-  Plugin_id[x] = 29;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_029;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_029;
+    {29, &Plugin_029, NULL, Plugin_029_Pulses, NULL, PLUGIN_DESC(Plugin_029_Desc)},
 #endif
-
 #ifdef PLUGIN_030
-  Plugin_id[x] = 30;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_030;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_030;
+    {30, NULL, &Plugin_030, Plugin_030_Pulses, NULL, PLUGIN_DESC(Plugin_030_Desc)},
 #endif
-
 #ifdef PLUGIN_031
-  Plugin_id[x] = 31;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_031;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_031;
+    {31, &Plugin_031, NULL, Plugin_031_Pulses, NULL, PLUGIN_DESC(Plugin_031_Desc)},
 #endif
-
 #ifdef PLUGIN_032
-  Plugin_id[x] = 32;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_032;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_032;
+    {32, &Plugin_032, NULL, Plugin_032_Pulses, NULL, PLUGIN_DESC(Plugin_032_Desc)},
 #endif
-
 #ifdef PLUGIN_033
-  Plugin_id[x] = 33;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_033;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_033;
+    {33, &Plugin_033, NULL, Plugin_033_Pulses, NULL, PLUGIN_DESC(Plugin_033_Desc)},
 #endif
-
 #ifdef PLUGIN_034
-  Plugin_id[x] = 34;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_034;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_034;
+    {34, NULL, &Plugin_034, Plugin_034_Pulses, NULL, PLUGIN_DESC(Plugin_034_Desc)},
 #endif
-
 #ifdef PLUGIN_035
-  Plugin_id[x] = 35;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_035;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_035;
+    {35, &Plugin_035, NULL, Plugin_035_Pulses, NULL, PLUGIN_DESC(Plugin_035_Desc)},
 #endif
-
 #ifdef PLUGIN_036
-  Plugin_id[x] = 36;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_036;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_036;
+    {36, NULL, &Plugin_036, Plugin_036_Pulses, NULL, PLUGIN_DESC(Plugin_036_Desc)},
 #endif
-
 #ifdef PLUGIN_037
-  Plugin_id[x] = 37;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_037;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_037;
+    {37, NULL, &Plugin_037, Plugin_037_Pulses, NULL, PLUGIN_DESC(Plugin_037_Desc)},
 #endif
-
 #ifdef PLUGIN_038
-  Plugin_id[x] = 38;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_038;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_038;
+    {38, &Plugin_038, NULL, NULL, NULL, PLUGIN_DESC(Plugin_038_Desc)},
 #endif
-
 #ifdef PLUGIN_039
-  Plugin_id[x] = 39;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_039;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_039;
+    {39, &Plugin_039, NULL, NULL, NULL, PLUGIN_DESC(Plugin_039_Desc)},
 #endif
-
 #ifdef PLUGIN_040
-  Plugin_id[x] = 40;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_040;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_040;
+    {40, &Plugin_040, NULL, Plugin_040_Pulses, NULL, PLUGIN_DESC(Plugin_040_Desc)},
 #endif
-
 #ifdef PLUGIN_041
-  Plugin_id[x] = 41;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_041;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_041;
+    {41, &Plugin_041, NULL, Plugin_041_Pulses, NULL, PLUGIN_DESC(Plugin_041_Desc)},
 #endif
-
 #ifdef PLUGIN_042
-  Plugin_id[x] = 42;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_042;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_042;
+    {42, NULL, &Plugin_042, Plugin_042_Pulses, &Plugin_042_Signature, PLUGIN_DESC(Plugin_042_Desc)},
 #endif
-
 #ifdef PLUGIN_043
-  Plugin_id[x] = 43;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_043;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_043;
+    {43, &Plugin_043, NULL, Plugin_043_Pulses, NULL, PLUGIN_DESC(Plugin_043_Desc)},
 #endif
-
 #ifdef PLUGIN_044
-  Plugin_id[x] = 44;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_044;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_044;
+    {44, &Plugin_044, NULL, Plugin_044_Pulses, NULL, PLUGIN_DESC(Plugin_044_Desc)},
 #endif
-
 #ifdef PLUGIN_045
-  Plugin_id[x] = 45;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_045;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_045;
+    {45, &Plugin_045, NULL, Plugin_045_Pulses, NULL, PLUGIN_DESC(Plugin_045_Desc)},
 #endif
-
 #ifdef PLUGIN_046
-  Plugin_id[x] = 46;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_046;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_046;
+    {46, NULL, &Plugin_046, Plugin_046_Pulses, NULL, PLUGIN_DESC(Plugin_046_Desc)},
 #endif
-
 #ifdef PLUGIN_047
-  Plugin_id[x] = 47;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_047;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_047;
+    {47, &Plugin_047, NULL, Plugin_047_Pulses, NULL, PLUGIN_DESC(Plugin_047_Desc)},
 #endif
-
 #ifdef PLUGIN_048
-  Plugin_id[x] = 48;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_048;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_048;
+    {48, &Plugin_048, NULL, NULL, NULL, PLUGIN_DESC(Plugin_048_Desc)},
 #endif
-
 #ifdef PLUGIN_049
-  Plugin_id[x] = 49;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_049;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_049;
+    {49, &Plugin_049, NULL, NULL, NULL, PLUGIN_DESC(Plugin_049_Desc)},
 #endif
-
 #ifdef PLUGIN_050
-  Plugin_id[x] = 50;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_050;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_050;
+    {50, &Plugin_050, NULL, NULL, NULL, PLUGIN_DESC(Plugin_050_Desc)},
 #endif
-
 #ifdef PLUGIN_051
-  Plugin_id[x] = 51;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_051;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_051;
+    {51, &Plugin_051, NULL, NULL, NULL, PLUGIN_DESC(Plugin_051_Desc)},
 #endif
-
 #ifdef PLUGIN_052
-  Plugin_id[x] = 52;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_052;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_052;
+    {52, &Plugin_052, NULL, NULL, NULL, PLUGIN_DESC(Plugin_052_Desc)},
 #endif
-
 #ifdef PLUGIN_053
-  Plugin_id[x] = 53;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_053;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_053;
+    {53, &Plugin_053, NULL, NULL, NULL, PLUGIN_DESC(Plugin_053_Desc)},
 #endif
-
 #ifdef PLUGIN_054
-  Plugin_id[x] = 54;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_054;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_054;
+    {54, &Plugin_054, NULL, NULL, NULL, PLUGIN_DESC(Plugin_054_Desc)},
 #endif
-
 #ifdef PLUGIN_055
-  Plugin_id[x] = 55;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_055;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_055;
+    {55, &Plugin_055, NULL, NULL, NULL, PLUGIN_DESC(Plugin_055_Desc)},
 #endif
-
 #ifdef PLUGIN_056
-  Plugin_id[x] = 56;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_056;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_056;
+    {56, &Plugin_056, NULL, NULL, NULL, PLUGIN_DESC(Plugin_056_Desc)},
 #endif
-
 #ifdef PLUGIN_057
-  Plugin_id[x] = 57;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_057;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_057;
+    {57, &Plugin_057, NULL, NULL, NULL, PLUGIN_DESC(Plugin_057_Desc)},
 #endif
-
 #ifdef PLUGIN_058
-  Plugin_id[x] = 58;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_058;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_058;
+    {58, &Plugin_058, NULL, NULL, NULL, PLUGIN_DESC(Plugin_058_Desc)},
 #endif
-
 #ifdef PLUGIN_059
-  Plugin_id[x] = 59;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_059;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_059;
+    {59, &Plugin_059, NULL, NULL, NULL, PLUGIN_DESC(Plugin_059_Desc)},
 #endif
-
 #ifdef PLUGIN_060
-  Plugin_id[x] = 60;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_060;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_060;
+    {60, &Plugin_060, NULL, Plugin_060_Pulses, &Plugin_060_Signature, PLUGIN_DESC(Plugin_060_Desc)},
 #endif
-
 #ifdef PLUGIN_061
-  Plugin_id[x] = 61;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_061;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_061;
+    {61, &Plugin_061, NULL, Plugin_061_Pulses, NULL, PLUGIN_DESC(Plugin_061_Desc)},
 #endif
-
 #ifdef PLUGIN_062
-  Plugin_id[x] = 62;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_062;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_062;
+    {62, &Plugin_062, NULL, Plugin_062_Pulses, NULL, PLUGIN_DESC(Plugin_062_Desc)},
 #endif
-
 #ifdef PLUGIN_063
-  Plugin_id[x] = 63;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_063;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_063;
+    {63, &Plugin_063, NULL, Plugin_063_Pulses, &Plugin_063_Signature, PLUGIN_DESC(Plugin_063_Desc)},
 #endif
-
 #ifdef PLUGIN_064
-  Plugin_id[x] = 64;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_064;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_064;
+    {64, NULL, &Plugin_064, Plugin_064_Pulses, NULL, PLUGIN_DESC(Plugin_064_Desc)},
 #endif
-
 #ifdef PLUGIN_065
-  Plugin_id[x] = 65;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_065;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_065;
+    {65, NULL, &Plugin_065, Plugin_065_Pulses, &Plugin_065_Signature, PLUGIN_DESC(Plugin_065_Desc)},
 #endif
-
 #ifdef PLUGIN_066
-  Plugin_id[x] = 66;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_066;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_066;
+    {66, &Plugin_066, NULL, NULL, NULL, PLUGIN_DESC(Plugin_066_Desc)},
 #endif
-
 #ifdef PLUGIN_067
-  Plugin_id[x] = 67;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_067;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_067;
+    {67, &Plugin_067, NULL, NULL, NULL, PLUGIN_DESC(Plugin_067_Desc)},
 #endif
-
 #ifdef PLUGIN_068
-  Plugin_id[x] = 68;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_068;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_068;
+    {68, &Plugin_068, NULL, NULL, NULL, PLUGIN_DESC(Plugin_068_Desc)},
 #endif
-
 #ifdef PLUGIN_069
-  Plugin_id[x] = 69;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_069;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_069;
+    {69, &Plugin_069, NULL, NULL, NULL, PLUGIN_DESC(Plugin_069_Desc)},
 #endif
-
 #ifdef PLUGIN_070
-  Plugin_id[x] = 70;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_070;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_070;
+    {70, NULL, &Plugin_070, Plugin_070_Pulses, NULL, PLUGIN_DESC(Plugin_070_Desc)},
 #endif
-
 #ifdef PLUGIN_071
-  Plugin_id[x] = 71;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_071;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_071;
+    {71, &Plugin_071, NULL, Plugin_071_Pulses, NULL, PLUGIN_DESC(Plugin_071_Desc)},
 #endif
-
 #ifdef PLUGIN_072
-  Plugin_id[x] = 72;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_072;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_072;
+    {72, NULL, &Plugin_072, Plugin_072_Pulses, &Plugin_072_Signature, PLUGIN_DESC(Plugin_072_Desc)},
 #endif
-
 #ifdef PLUGIN_073
-  Plugin_id[x] = 73;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_073;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_073;
+    {73, &Plugin_073, NULL, Plugin_073_Pulses, NULL, PLUGIN_DESC(Plugin_073_Desc)},
 #endif
-
 #ifdef PLUGIN_074
-  Plugin_id[x] = 74;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_074;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_074;
+    {74, &Plugin_074, NULL, Plugin_074_Pulses, NULL, PLUGIN_DESC(Plugin_074_Desc)},
 #endif
-
 #ifdef PLUGIN_075
-  Plugin_id[x] = 75;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_075;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_075;
+    {75, &Plugin_075, NULL, Plugin_075_Pulses, NULL, PLUGIN_DESC(Plugin_075_Desc)},
 #endif
-
 #ifdef PLUGIN_076
-  Plugin_id[x] = 76;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_076;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_076;
+    {76, &Plugin_076, NULL, NULL, NULL, PLUGIN_DESC(Plugin_076_Desc)},
 #endif
-
 #ifdef PLUGIN_077
-  Plugin_id[x] = 77;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_077;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_077;
+    {77, &Plugin_077, NULL, NULL, NULL, PLUGIN_DESC(Plugin_077_Desc)},
 #endif
-
 #ifdef PLUGIN_078
-  Plugin_id[x] = 78;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_078;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_078;
+    {78, &Plugin_078, NULL, NULL, NULL, PLUGIN_DESC(Plugin_078_Desc)},
 #endif
-
 #ifdef PLUGIN_079
-  Plugin_id[x] = 79;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_079;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_079;
+    {79, &Plugin_079, NULL, NULL, NULL, PLUGIN_DESC(Plugin_079_Desc)},
 #endif
-
 #ifdef PLUGIN_080
-  Plugin_id[x] = 80;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_080;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_080;
+    {80, &Plugin_080, NULL, Plugin_080_Pulses, NULL, PLUGIN_DESC(Plugin_080_Desc)},
 #endif
-
 #ifdef PLUGIN_081
-  Plugin_id[x] = 81;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_081;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_081;
+    {81, &Plugin_081, NULL, Plugin_081_Pulses, NULL, PLUGIN_DESC(Plugin_081_Desc)},
 #endif
-
 #ifdef PLUGIN_082
-  Plugin_id[x] = 82;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_082;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_082;
+    {82, &Plugin_082, NULL, Plugin_082_Pulses, &Plugin_082_Signature, PLUGIN_DESC(Plugin_082_Desc)},
 #endif
-
 #ifdef PLUGIN_083
-  Plugin_id[x] = 83;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_083;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_083;
+    {83, &Plugin_083, NULL, Plugin_083_Pulses, NULL, PLUGIN_DESC(Plugin_083_Desc)},
 #endif
-
 #ifdef PLUGIN_084
-  Plugin_id[x] = 84;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_084;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_084;
+    {84, &Plugin_084, NULL, NULL, NULL, PLUGIN_DESC(Plugin_084_Desc)},
 #endif
-
 #ifdef PLUGIN_085
-  Plugin_id[x] = 85;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_085;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_085;
+    {85, &Plugin_085, NULL, NULL, NULL, PLUGIN_DESC(Plugin_085_Desc)},
 #endif
-
 #ifdef PLUGIN_086
-  Plugin_id[x] = 86;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_086;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_086;
+    {86, &Plugin_086, NULL, NULL, NULL, PLUGIN_DESC(Plugin_086_Desc)},
 #endif
-
 #ifdef PLUGIN_087
-  Plugin_id[x] = 87;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_087;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_087;
+    {87, &Plugin_087, NULL, NULL, NULL, PLUGIN_DESC(Plugin_087_Desc)},
 #endif
-
 #ifdef PLUGIN_088
-  Plugin_id[x] = 88;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_088;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_088;
+    {88, &Plugin_088, NULL, NULL, NULL, PLUGIN_DESC(Plugin_088_Desc)},
 #endif
-
 #ifdef PLUGIN_089
-  Plugin_id[x] = 89;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_089;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_089;
+    {89, &Plugin_089, NULL, NULL, NULL, PLUGIN_DESC(Plugin_089_Desc)},
 #endif
-
 #ifdef PLUGIN_090
-  Plugin_id[x] = 90;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_090;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_090;
+    {90, &Plugin_090, NULL, NULL, NULL, PLUGIN_DESC(Plugin_090_Desc)},
 #endif
-
 #ifdef PLUGIN_091
-  Plugin_id[x] = 91;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_091;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_091;
+    {91, &Plugin_091, NULL, NULL, NULL, PLUGIN_DESC(Plugin_091_Desc)},
 #endif
-
 #ifdef PLUGIN_092
-  Plugin_id[x] = 92;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_092;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_092;
+    {92, &Plugin_092, NULL, NULL, NULL, PLUGIN_DESC(Plugin_092_Desc)},
 #endif
-
 #ifdef PLUGIN_093
-  Plugin_id[x] = 93;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_093;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_093;
+    {93, &Plugin_093, NULL, NULL, NULL, PLUGIN_DESC(Plugin_093_Desc)},
 #endif
-
 #ifdef PLUGIN_094
-  Plugin_id[x] = 94;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_094;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_094;
+    {94, &Plugin_094, NULL, NULL, NULL, PLUGIN_DESC(Plugin_094_Desc)},
 #endif
-
 #ifdef PLUGIN_095
-  Plugin_id[x] = 95;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_095;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_095;
+    {95, &Plugin_095, NULL, NULL, NULL, PLUGIN_DESC(Plugin_095_Desc)},
 #endif
-
 #ifdef PLUGIN_096
-  Plugin_id[x] = 96;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_096;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_096;
+    {96, &Plugin_096, NULL, NULL, NULL, PLUGIN_DESC(Plugin_096_Desc)},
 #endif
-
 #ifdef PLUGIN_097
-  Plugin_id[x] = 97;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_097;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_097;
+    {97, &Plugin_097, NULL, NULL, NULL, PLUGIN_DESC(Plugin_097_Desc)},
 #endif
-
 #ifdef PLUGIN_098
-  Plugin_id[x] = 98;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_098;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_098;
+    {98, &Plugin_098, NULL, NULL, NULL, PLUGIN_DESC(Plugin_098_Desc)},
 #endif
-
 #ifdef PLUGIN_099
-  Plugin_id[x] = 99;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_099;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_099;
+    {99, &Plugin_099, NULL, NULL, NULL, PLUGIN_DESC(Plugin_099_Desc)},
 #endif
-
 #ifdef PLUGIN_100
-  Plugin_id[x] = 100;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_100;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_100;
+    {100, &Plugin_100, NULL, NULL, NULL, PLUGIN_DESC(Plugin_100_Desc)},
 #endif
-
 #ifdef PLUGIN_101
-  Plugin_id[x] = 101;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_101;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_101;
+    {101, &Plugin_101, NULL, NULL, NULL, PLUGIN_DESC(Plugin_101_Desc)},
 #endif
-
 #ifdef PLUGIN_102
-  Plugin_id[x] = 102;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_102;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_102;
+    {102, &Plugin_102, NULL, NULL, NULL, PLUGIN_DESC(Plugin_102_Desc)},
 #endif
-
 #ifdef PLUGIN_103
-  Plugin_id[x] = 103;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_103;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_103;
+    {103, &Plugin_103, NULL, NULL, NULL, PLUGIN_DESC(Plugin_103_Desc)},
 #endif
-
 #ifdef PLUGIN_104
-  Plugin_id[x] = 104;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_104;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_104;
+    {104, &Plugin_104, NULL, NULL, NULL, PLUGIN_DESC(Plugin_104_Desc)},
 #endif
-
 #ifdef PLUGIN_105
-  Plugin_id[x] = 105;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_105;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_105;
+    {105, &Plugin_105, NULL, NULL, NULL, PLUGIN_DESC(Plugin_105_Desc)},
 #endif
-
 #ifdef PLUGIN_106
-  Plugin_id[x] = 106;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_106;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_106;
+    {106, &Plugin_106, NULL, NULL, NULL, PLUGIN_DESC(Plugin_106_Desc)},
 #endif
-
 #ifdef PLUGIN_107
-  Plugin_id[x] = 107;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_107;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_107;
+    {107, &Plugin_107, NULL, NULL, NULL, PLUGIN_DESC(Plugin_107_Desc)},
 #endif
-
 #ifdef PLUGIN_108
-  Plugin_id[x] = 108;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_108;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_108;
+    {108, &Plugin_108, NULL, NULL, NULL, PLUGIN_DESC(Plugin_108_Desc)},
 #endif
-
 #ifdef PLUGIN_109
-  Plugin_id[x] = 109;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_109;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_109;
+    {109, &Plugin_109, NULL, NULL, NULL, PLUGIN_DESC(Plugin_109_Desc)},
 #endif
-
 #ifdef PLUGIN_110
-  Plugin_id[x] = 110;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_110;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_110;
+    {110, &Plugin_110, NULL, NULL, NULL, PLUGIN_DESC(Plugin_110_Desc)},
 #endif
-
 #ifdef PLUGIN_111
-  Plugin_id[x] = 111;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_111;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_111;
+    {111, &Plugin_111, NULL, NULL, NULL, PLUGIN_DESC(Plugin_111_Desc)},
 #endif
-
 #ifdef PLUGIN_112
-  Plugin_id[x] = 112;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_112;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_112;
+    {112, &Plugin_112, NULL, NULL, NULL, PLUGIN_DESC(Plugin_112_Desc)},
 #endif
-
 #ifdef PLUGIN_113
-  Plugin_id[x] = 113;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_113;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_113;
+    {113, &Plugin_113, NULL, NULL, NULL, PLUGIN_DESC(Plugin_113_Desc)},
 #endif
-
 #ifdef PLUGIN_114
-  Plugin_id[x] = 114;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_114;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_114;
+    {114, &Plugin_114, NULL, NULL, NULL, PLUGIN_DESC(Plugin_114_Desc)},
 #endif
-
 #ifdef PLUGIN_115
-  Plugin_id[x] = 115;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_115;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_115;
+    {115, &Plugin_115, NULL, NULL, NULL, PLUGIN_DESC(Plugin_115_Desc)},
 #endif
-
 #ifdef PLUGIN_116
-  Plugin_id[x] = 116;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_116;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_116;
+    {116, &Plugin_116, NULL, NULL, NULL, PLUGIN_DESC(Plugin_116_Desc)},
 #endif
-
 #ifdef PLUGIN_117
-  Plugin_id[x] = 117;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_117;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_117;
+    {117, &Plugin_117, NULL, NULL, NULL, PLUGIN_DESC(Plugin_117_Desc)},
 #endif
-
 #ifdef PLUGIN_118
-  Plugin_id[x] = 118;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_118;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_118;
+    {118, &Plugin_118, NULL, NULL, NULL, PLUGIN_DESC(Plugin_118_Desc)},
 #endif
-
 #ifdef PLUGIN_119
-  Plugin_id[x] = 119;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_119;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_119;
+    {119, &Plugin_119, NULL, NULL, NULL, PLUGIN_DESC(Plugin_119_Desc)},
 #endif
-
 #ifdef PLUGIN_120
-  Plugin_id[x] = 120;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_120;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_120;
+    {120, &Plugin_120, NULL, NULL, NULL, PLUGIN_DESC(Plugin_120_Desc)},
 #endif
-
 #ifdef PLUGIN_250
-  Plugin_id[x] = 250;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_250;
+    {250, &Plugin_250, NULL, NULL, NULL, PLUGIN_DESC(Plugin_250_Desc)},
 #endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_250;
+#ifdef PLUGIN_251
+    {251, &Plugin_251, NULL, NULL, NULL, PLUGIN_DESC(Plugin_251_Desc)},
 #endif
-
-#ifdef PLUGIN_251
-  Plugin_id[x] = 251;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_251;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_251;
-#endif
-
 #ifdef PLUGIN_252
-  Plugin_id[x] = 252;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_252;
-#endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_252;
+    {252, &Plugin_252, NULL, NULL, NULL, PLUGIN_DESC(Plugin_252_Desc)},
 #endif
-
 #ifdef PLUGIN_253
-  Plugin_id[x] = 253;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_253;
+    {253, &Plugin_253, NULL, NULL, NULL, PLUGIN_DESC(Plugin_253_Desc)},
 #endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_253;
-#endif
-
 #ifdef PLUGIN_254
-  Plugin_id[x] = 254;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_254;
+    {254, &Plugin_254, NULL, NULL, NULL, PLUGIN_DESC(Plugin_254_Desc)},
 #endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_254;
-#endif
-
 #ifdef PLUGIN_255
-  Plugin_id[x] = 255;
-#ifndef ARDUINO_AVR_UNO
-  Plugin_Description[x] = PLUGIN_DESC_255;
+    {255, &Plugin_255, NULL, NULL, NULL, PLUGIN_DESC(Plugin_255_Desc)},
 #endif
-  Plugin_State[x] = P_Enabled;
-  Plugin_ptr[x++] = &Plugin_255;
-#endif
-
-  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
-  PluginInitCall(0, 0);
-}
-/*********************************************************************************************/
-void PluginTXInit(void)
-{
-  byte x;
-
-  // Wis de pointertabel voor de plugins.
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
-  {
-    PluginTX_ptr[x] = 0;
-    PluginTX_id[x] = 0;
-  }
-
-  x = 0;
+};
+#define PLUGIN_COUNT (sizeof(Plugins) / sizeof(Plugins[0]))
+const byte PluginCount = PLUGIN_COUNT;
 
+const PluginTXEntry PluginsTX[] PROGMEM = {
 #ifdef PLUGIN_TX_001
-  PluginTX_id[x] = 1;
-  PluginTX_ptr[x++] = &PluginTX_001;
+    {1, &PluginTX_001},
 #endif
-
 #ifdef PLUGIN_TX_002
-  PluginTX_id[x] = 2;
-  PluginTX_ptr[x++] = &PluginTX_002;
+    {2, &PluginTX_002},
 #endif
-
 #ifdef PLUGIN_TX_003
-  PluginTX_id[x] = 3;
-  PluginTX_ptr[x++] = &PluginTX_003;
+    {3, &PluginTX_003},
 #endif
-
 #ifdef PLUGIN_TX_004
-  PluginTX_id[x] = 4;
-  PluginTX_ptr[x++] = &PluginTX_004;
+    {4, &PluginTX_004},
 #endif
-
 #ifdef PLUGIN_TX_005
-  PluginTX_id[x] = 5;
-  PluginTX_ptr[x++] = &PluginTX_005;
+    {5, &PluginTX_005},
 #endif
-
 #ifdef PLUGIN_TX_006
-  PluginTX_id[x] = 6;
-  PluginTX_ptr[x++] = &PluginTX_006;
+    {6, &PluginTX_006},
 #endif
-
 #ifdef PLUGIN_TX_007
-  PluginTX_id[x] = 7;
-  PluginTX_ptr[x++] = &PluginTX_007;
+    {7, &PluginTX_007},
 #endif
-
 #ifdef PLUGIN_TX_008
-  PluginTX_id[x] = 8;
-  PluginTX_ptr[x++] = &PluginTX_008;
+    {8, &PluginTX_008},
 #endif
-
 #ifdef PLUGIN_TX_009
-  PluginTX_id[x] = 9;
-  PluginTX_ptr[x++] = &PluginTX_009;
+    {9, &PluginTX_009},
 #endif
-
 #ifdef PLUGIN_TX_010
-  PluginTX_id[x] = 10;
-  PluginTX_ptr[x++] = &PluginTX_010;
+    {10, &PluginTX_010},
 #endif
-
 #ifdef PLUGIN_TX_011
-  PluginTX_id[x] = 11;
-  PluginTX_ptr[x++] = &PluginTX_011;
+    {11, &PluginTX_011},
 #endif
-
 #ifdef PLUGIN_TX_012
-  PluginTX_id[x] = 12;
-  PluginTX_ptr[x++] = &PluginTX_012;
+    {12, &PluginTX_012},
 #endif
-
 #ifdef PLUGIN_TX_013
-  PluginTX_id[x] = 13;
-  PluginTX_ptr[x++] = &PluginTX_013;
+    {13, &PluginTX_013},
 #endif
-
 #ifdef PLUGIN_TX_014
-  PluginTX_id[x] = 14;
-  PluginTX_ptr[x++] = &PluginTX_014;
+    {14, &PluginTX_014},
 #endif
-
 #ifdef PLUGIN_TX_015
-  PluginTX_id[x] = 15;
-  PluginTX_ptr[x++] = &PluginTX_015;
+    {15, &PluginTX_015},
 #endif
-
 #ifdef PLUGIN_TX_016
-  PluginTX_id[x] = 16;
-  PluginTX_ptr[x++] = &PluginTX_016;
+    {16, &PluginTX_016},
 #endif
-
 #ifdef PLUGIN_TX_017
-  PluginTX_id[x] = 17;
-  PluginTX_ptr[x++] = &PluginTX_017;
+    {17, &PluginTX_017},
 #endif
-
 #ifdef PLUGIN_TX_018
-  PluginTX_id[x] = 18;
-  PluginTX_ptr[x++] = &PluginTX_018;
+    {18, &PluginTX_018},
 #endif
-
 #ifdef PLUGIN_TX_019
-  PluginTX_id[x] = 19;
-  PluginTX_ptr[x++] = &PluginTX_019;
+    {19, &PluginTX_019},
 #endif
-
 #ifdef PLUGIN_TX_020
-  PluginTX_id[x] = 20;
-  PluginTX_ptr[x++] = &PluginTX_020;
+    {20, &PluginTX_020},
 #endif
-
 #ifdef PLUGIN_TX_021
-  PluginTX_id[x] = 21;
-  PluginTX_ptr[x++] = &PluginTX_021;
+    {21, &PluginTX_021},
 #endif
-
 #ifdef PLUGIN_TX_022
-  PluginTX_id[x] = 22;
-  PluginTX_ptr[x++] = &PluginTX_022;
+    {22, &PluginTX_022},
 #endif
-
 #ifdef PLUGIN_TX_023
-  PluginTX_id[x] = 23;
-  PluginTX_ptr[x++] = &PluginTX_023;
+    {23, &PluginTX_023},
 #endif
-
 #ifdef PLUGIN_TX_024
-  PluginTX_id[x] = 24;
-  PluginTX_ptr[x++] = &PluginTX_024;
+    {24, &PluginTX_024},
 #endif
-
 #ifdef PLUGIN_TX_025
-  PluginTX_id[x] = 25;
-  PluginTX_ptr[x++] = &PluginTX_025;
+    {25, &PluginTX_025},
 #endif
-
 #ifdef PLUGIN_TX_026
-  PluginTX_id[x] = 26;
-  PluginTX_ptr[x++] = &PluginTX_026;
+    {26, &PluginTX_026},
 #endif
-
 #ifdef PLUGIN_TX_027
-  PluginTX_id[x] = 27;
-  PluginTX_ptr[x++] = &PluginTX_027;
+    {27, &PluginTX_027},
 #endif
-
 #ifdef PLUGIN_TX_028
-  PluginTX_id[x] = 28;
-  PluginTX_ptr[x++] = &PluginTX_028;
+    {28, &PluginTX_028},
 #endif
-
 #ifdef PLUGIN_TX_029
-  PluginTX_id[x] = 29;
-  PluginTX_ptr[x++] = &PluginTX_029;
+    {29, &PluginTX_029},
 #endif
-
 #ifdef PLUGIN_TX_030
-  PluginTX_id[x] = 30;
-  PluginTX_ptr[x++] = &PluginTX_030;
+    {30, &PluginTX_030},
 #endif
-
 #ifdef PLUGIN_TX_031
-  PluginTX_id[x] = 31;
-  PluginTX_ptr[x++] = &PluginTX_031;
+    {31, &PluginTX_031},
 #endif
-
 #ifdef PLUGIN_TX_032
-  PluginTX_id[x] = 32;
-  PluginTX_ptr[x++] = &PluginTX_032;
+    {32, &PluginTX_032},
 #endif
-
 #ifdef PLUGIN_TX_033
-  PluginTX_id[x] = 33;
-  PluginTX_ptr[x++] = &PluginTX_033;
+    {33, &PluginTX_033},
 #endif
-
 #ifdef PLUGIN_TX_034
-  PluginTX_id[x] = 34;
-  PluginTX_ptr[x++] = &PluginTX_034;
+    {34, &PluginTX_034},
 #endif
-
 #ifdef PLUGIN_TX_035
-  PluginTX_id[x] = 35;
-  PluginTX_ptr[x++] = &PluginTX_035;
+    {35, &PluginTX_035},
 #endif
-
 #ifdef PLUGIN_TX_036
-  PluginTX_id[x] = 36;
-  PluginTX_ptr[x++] = &PluginTX_036;
+    {36, &PluginTX_036},
 #endif
-
 #ifdef PLUGIN_TX_037
-  PluginTX_id[x] = 37;
-  PluginTX_ptr[x++] = &PluginTX_037;
+    {37, &PluginTX_037},
 #endif
-
 #ifdef PLUGIN_TX_038
-  PluginTX_id[x] = 38;
-  PluginTX_ptr[x++] = &PluginTX_038;
+    {38, &PluginTX_038},
 #endif
-
 #ifdef PLUGIN_TX_039
-  PluginTX_id[x] = 39;
-  PluginTX_ptr[x++] = &PluginTX_039;
+    {39, &PluginTX_039},
 #endif
-
 #ifdef PLUGIN_TX_040
-  PluginTX_id[x] = 40;
-  PluginTX_ptr[x++] = &PluginTX_040;
+    {40, &PluginTX_040},
 #endif
-
 #ifdef PLUGIN_TX_041
-  PluginTX_id[x] = 41;
-  PluginTX_ptr[x++] = &PluginTX_041;
+    {41, &PluginTX_041},
 #endif
-
 #ifdef PLUGIN_TX_042
-  PluginTX_id[x] = 42;
-  PluginTX_ptr[x++] = &PluginTX_042;
+    {42, &PluginTX_042},
 #endif
-
 #ifdef PLUGIN_TX_043
-  PluginTX_id[x] = 43;
-  PluginTX_ptr[x++] = &PluginTX_043;
+    {43, &PluginTX_043},
 #endif
-
 #ifdef PLUGIN_TX_044
-  PluginTX_id[x] = 44;
-  PluginTX_ptr[x++] = &PluginTX_044;
+    {44, &PluginTX_044},
 #endif
-
 #ifdef PLUGIN_TX_045
-  PluginTX_id[x] = 45;
-  PluginTX_ptr[x++] = &PluginTX_045;
+    {45, &PluginTX_045},
 #endif
-
 #ifdef PLUGIN_TX_046
-  PluginTX_id[x] = 46;
-  PluginTX_ptr[x++] = &PluginTX_046;
+    {46, &PluginTX_046},
 #endif
-
 #ifdef PLUGIN_TX_047
-  PluginTX_id[x] = 47;
-  PluginTX_ptr[x++] = &PluginTX_047;
+    {47, &PluginTX_047},
 #endif
-
 #ifdef PLUGIN_TX_048
-  PluginTX_id[x] = 48;
-  PluginTX_ptr[x++] = &PluginTX_048;
+    {48, &PluginTX_048},
 #endif
-
 #ifdef PLUGIN_TX_049
-  PluginTX_id[x] = 49;
-  PluginTX_ptr[x++] = &PluginTX_049;
+    {49, &PluginTX_049},
 #endif
-
 #ifdef PLUGIN_TX_050
-  PluginTX_id[x] = 50;
-  PluginTX_ptr[x++] = &PluginTX_050;
+    {50, &PluginTX_050},
 #endif
-
 #ifdef PLUGIN_TX_051
-  PluginTX_id[x] = 51;
-  PluginTX_ptr[x++] = &PluginTX_051;
+    {51, &PluginTX_051},
 #endif
-
 #ifdef PLUGIN_TX_052
-  PluginTX_id[x] = 52;
-  PluginTX_ptr[x++] = &PluginTX_052;
+    {52, &PluginTX_052},
 #endif
-
 #ifdef PLUGIN_TX_053
-  PluginTX_id[x] = 53;
-  PluginTX_ptr[x++] = &PluginTX_053;
+    {53, &PluginTX_053},
 #endif
-
 #ifdef PLUGIN_TX_054
-  PluginTX_id[x] = 54;
-  PluginTX_ptr[x++] = &PluginTX_054;
+    {54, &PluginTX_054},
 #endif
-
 #ifdef PLUGIN_TX_055
-  PluginTX_id[x] = 55;
-  PluginTX_ptr[x++] = &PluginTX_055;
+    {55, &PluginTX_055},
 #endif
-
 #ifdef PLUGIN_TX_056
-  PluginTX_id[x] = 56;
-  PluginTX_ptr[x++] = &PluginTX_056;
+    {56, &PluginTX_056},
 #endif
-
 #ifdef PLUGIN_TX_057
-  PluginTX_id[x] = 57;
-  PluginTX_ptr[x++] = &PluginTX_057;
+    {57, &PluginTX_057},
 #endif
-
 #ifdef PLUGIN_TX_058
-  PluginTX_id[x] = 58;
-  PluginTX_ptr[x++] = &PluginTX_058;
+    {58, &PluginTX_058},
 #endif
-
 #ifdef PLUGIN_TX_059
-  PluginTX_id[x] = 59;
-  PluginTX_ptr[x++] = &PluginTX_059;
+    {59, &PluginTX_059},
 #endif
-
 #ifdef PLUGIN_TX_060
-  PluginTX_id[x] = 60;
-  PluginTX_ptr[x++] = &PluginTX_060;
+    {60, &PluginTX_060},
 #endif
-
 #ifdef PLUGIN_TX_061
-  PluginTX_id[x] = 61;
-  PluginTX_ptr[x++] = &PluginTX_061;
+    {61, &PluginTX_061},
 #endif
-
 #ifdef PLUGIN_TX_062
-  PluginTX_id[x] = 62;
-  PluginTX_ptr[x++] = &PluginTX_062;
+    {62, &PluginTX_062},
 #endif
-
 #ifdef PLUGIN_TX_063
-  PluginTX_id[x] = 63;
-  PluginTX_ptr[x++] = &PluginTX_063;
+    {63, &PluginTX_063},
 #endif
-
 #ifdef PLUGIN_TX_064
-  PluginTX_id[x] = 64;
-  PluginTX_ptr[x++] = &PluginTX_064;
+    {64, &PluginTX_064},
 #endif
-
 #ifdef PLUGIN_TX_065
-  PluginTX_id[x] = 65;
-  PluginTX_ptr[x++] = &PluginTX_065;
+    {65, &PluginTX_065},
 #endif
-
 #ifdef PLUGIN_TX_066
-  PluginTX_id[x] = 66;
-  PluginTX_ptr[x++] = &PluginTX_066;
+    {66, &PluginTX_066},
 #endif
-
 #ifdef PLUGIN_TX_067
-  PluginTX_id[x] = 67;
-  PluginTX_ptr[x++] = &PluginTX_067;
+    {67, &PluginTX_067},
 #endif
-
 #ifdef PLUGIN_TX_068
-  PluginTX_id[x] = 68;
-  PluginTX_ptr[x++] = &PluginTX_068;
+    {68, &PluginTX_068},
 #endif
-
 #ifdef PLUGIN_TX_069
-  PluginTX_id[x] = 69;
-  PluginTX_ptr[x++] = &PluginTX_069;
+    {69, &PluginTX_069},
 #endif
-
 #ifdef PLUGIN_TX_070
-  PluginTX_id[x] = 70;
-  PluginTX_ptr[x++] = &PluginTX_070;
+    {70, &PluginTX_070},
 #endif
-
 #ifdef PLUGIN_TX_071
-  PluginTX_id[x] = 71;
-  PluginTX_ptr[x++] = &PluginTX_071;
+    {71, &PluginTX_071},
 #endif
-
 #ifdef PLUGIN_TX_072
-  PluginTX_id[x] = 72;
-  PluginTX_ptr[x++] = &PluginTX_072;
+    {72, &PluginTX_072},
 #endif
-
 #ifdef PLUGIN_TX_073
-  PluginTX_id[x] = 73;
-  PluginTX_ptr[x++] = &PluginTX_073;
+    {73, &PluginTX_073},
 #endif
-
 #ifdef PLUGIN_TX_074
-  PluginTX_id[x] = 74;
-  PluginTX_ptr[x++] = &PluginTX_074;
+    {74, &PluginTX_074},
 #endif
-
 #ifdef PLUGIN_TX_075
-  PluginTX_id[x] = 75;
-  PluginTX_ptr[x++] = &PluginTX_075;
+    {75, &PluginTX_075},
 #endif
-
 #ifdef PLUGIN_TX_076
-  PluginTX_id[x] = 76;
-  PluginTX_ptr[x++] = &PluginTX_076;
+    {76, &PluginTX_076},
 #endif
-
 #ifdef PLUGIN_TX_077
-  PluginTX_id[x] = 77;
-  PluginTX_ptr[x++] = &PluginTX_077;
+    {77, &PluginTX_077},
 #endif
-
 #ifdef PLUGIN_TX_078
-  PluginTX_id[x] = 78;
-  PluginTX_ptr[x++] = &PluginTX_078;
+    {78, &PluginTX_078},
 #endif
-
 #ifdef PLUGIN_TX_079
-  PluginTX_id[x] = 79;
-  PluginTX_ptr[x++] = &PluginTX_079;
+    {79, &PluginTX_079},
 #endif
-
 #ifdef PLUGIN_TX_080
-  PluginTX_id[x] = 80;
-  PluginTX_ptr[x++] = &PluginTX_080;
+    {80, &PluginTX_080},
 #endif
-
 #ifdef PLUGIN_TX_081
-  PluginTX_id[x] = 81;
-  PluginTX_ptr[x++] = &PluginTX_081;
+    {81, &PluginTX_081},
 #endif
-
 #ifdef PLUGIN_TX_082
-  PluginTX_id[x] = 82;
-  PluginTX_ptr[x++] = &PluginTX_082;
+    {82, &PluginTX_082},
 #endif
-
 #ifdef PLUGIN_TX_083
-  PluginTX_id[x] = 83;
-  PluginTX_ptr[x++] = &PluginTX_083;
+    {83, &PluginTX_083},
 #endif
-
 #ifdef PLUGIN_TX_084
-  PluginTX_id[x] = 84;
-  PluginTX_ptr[x++] = &PluginTX_084;
+    {84, &PluginTX_084},
 #endif
-
 #ifdef PLUGIN_TX_085
-  PluginTX_id[x] = 85;
-  PluginTX_ptr[x++] = &PluginTX_085;
+    {85, &PluginTX_085},
 #endif
-
 #ifdef PLUGIN_TX_086
-  PluginTX_id[x] = 86;
-  PluginTX_ptr[x++] = &PluginTX_086;
+    {86, &PluginTX_086},
 #endif
-
 #ifdef PLUGIN_TX_087
-  PluginTX_id[x] = 87;
-  PluginTX_ptr[x++] = &PluginTX_087;
+    {87, &PluginTX_087},
 #endif
-
 #ifdef PLUGIN_TX_088
-  PluginTX_id[x] = 88;
-  PluginTX_ptr[x++] = &PluginTX_088;
+    {88, &PluginTX_088},
 #endif
-
 #ifdef PLUGIN_TX_089
-  PluginTX_id[x] = 89;
-  PluginTX_ptr[x++] = &PluginTX_089;
+    {89, &PluginTX_089},
 #endif
-
 #ifdef PLUGIN_TX_090
-  PluginTX_id[x] = 90;
-  PluginTX_ptr[x++] = &PluginTX_090;
+    {90, &PluginTX_090},
 #endif
-
 #ifdef PLUGIN_TX_091
-  PluginTX_id[x] = 91;
-  PluginTX_ptr[x++] = &PluginTX_091;
+    {91, &PluginTX_091},
 #endif
-
 #ifdef PLUGIN_TX_092
-  PluginTX_id[x] = 92;
-  PluginTX_ptr[x++] = &PluginTX_092;
+    {92, &PluginTX_092},
 #endif
-
 #ifdef PLUGIN_TX_093
-  PluginTX_id[x] = 93;
-  PluginTX_ptr[x++] = &PluginTX_093;
+    {93, &PluginTX_093},
 #endif
-
 #ifdef PLUGIN_TX_094
-  PluginTX_id[x] = 94;
-  PluginTX_ptr[x++] = &PluginTX_094;
+    {94, &PluginTX_094},
 #endif
-
 #ifdef PLUGIN_TX_095
-  PluginTX_id[x] = 95;
-  PluginTX_ptr[x++] = &PluginTX_095;
+    {95, &PluginTX_095},
 #endif
-
 #ifdef PLUGIN_TX_096
-  PluginTX_id[x] = 96;
-  PluginTX_ptr[x++] = &PluginTX_096;
+    {96, &PluginTX_096},
 #endif
-
 #ifdef PLUGIN_TX_097
-  PluginTX_id[x] = 97;
-  PluginTX_ptr[x++] = &PluginTX_097;
+    {97, &PluginTX_097},
 #endif
-
 #ifdef PLUGIN_TX_098
-  PluginTX_id[x] = 98;
-  PluginTX_ptr[x++] = &PluginTX_098;
+    {98, &PluginTX_098},
 #endif
-
 #ifdef PLUGIN_TX_099
-  PluginTX_id[x] = 99;
-  PluginTX_ptr[x++] = &PluginTX_099;
+    {99, &PluginTX_099},
 #endif
-
 #ifdef PLUGIN_TX_100
-  PluginTX_id[x] = 100;
-  PluginTX_ptr[x++] = &PluginTX_100;
+    {100, &PluginTX_100},
 #endif
-
 #ifdef PLUGIN_TX_250
-  PluginTX_id[x] = 250;
-  PluginTX_ptr[x++] = &PluginTX_250;
+    {250, &PluginTX_250},
 #endif
-
 #ifdef PLUGIN_TX_251
-  PluginTX_id[x] = 251;
-  PluginTX_ptr[x++] = &PluginTX_251;
+    {251, &PluginTX_251},
 #endif
-
 #ifdef PLUGIN_TX_252
-  PluginTX_id[x] = 252;
-  PluginTX_ptr[x++] = &PluginTX_252;
+    {252, &PluginTX_252},
 #endif
-
 #ifdef PLUGIN_TX_253
-  PluginTX_id[x] = 253;
-  PluginTX_ptr[x++] = &PluginTX_253;
+    {253, &PluginTX_253},
 #endif
-
 #ifdef PLUGIN_TX_254
-  PluginTX_id[x] = 254;
-  PluginTX_ptr[x++] = &PluginTX_254;
+    {254, &PluginTX_254},
 #endif
-
 #ifdef PLUGIN_TX_255
-  PluginTX_id[x] = 255;
-  PluginTX_ptr[x++] = &PluginTX_255;
+    {255, &PluginTX_255},
+#endif
+};
+#define PLUGIN_TX_COUNT (sizeof(PluginsTX) / sizeof(PluginsTX[0]))
+const byte PluginTXCount = PLUGIN_TX_COUNT;
+
+#ifdef PLUGIN_PULSE_INDEX
+// Pulse count index: bit x of row (RawSignal.Number / PLUGIN_INDEX_STEP) is set when Plugins[x] accepts
+// one of the pulse counts of that row. Plugins without Plugin_xxx_Pulses[] are set in every row.
+#define PLUGIN_INDEX_ROWS (RAW_BUFFER_SIZE / PLUGIN_INDEX_STEP + 1)
+static byte Plugin_Index[PLUGIN_INDEX_ROWS][(PLUGIN_COUNT + 7) / 8];
+#endif
+
+#ifdef PLUGIN_ADAPTIVE_ORDER
+// Plugins[] indexes in calling order, re-sorted on Plugin_Hits every PLUGIN_REORDER_DECODES decodes
+static byte Plugin_Order[PLUGIN_COUNT];
+static uint16_t Plugin_Hits[PLUGIN_COUNT]; // decodes per plugin, halved at every reorder to follow changes
+static byte Plugin_Decodes = 0;            // decodes since the last reorder
+#define PLUGIN_AT(i) Plugin_Order[i]
+#else
+#define PLUGIN_AT(i) (i)
+#endif
+
+#ifdef PLUGIN_PROFILER
+// Time spent in each plugin, in CPU cycles. ESP reads the cycle counter, AVR with RF_ICP_ENABLED
+// the capture timer (ICP_PRESCALER cycles per tick, a call over 32 mSec wraps). Other AVR builds
+// derive them from micros(): 4 uSec (64 cycles) steps at 16 MHz, short decoders show 0, 64 or 128.
+#if (defined(ESP32) || defined(ESP8266))
+#define PROFILE_CLOCK() ESP.getCycleCount()
+#define PROFILE_CYCLES(Ticks) (Ticks)
+#elif defined(RF_ICP_ENABLED)
+#define PROFILE_CLOCK() read_Capture_Timer()
+#define PROFILE_CYCLES(Ticks) ((unsigned long)(uint16_t)(Ticks) * ICP_PRESCALER)
+#else
+#define PROFILE_CLOCK() micros()
+#define PROFILE_CYCLES(Ticks) ((Ticks) * clockCyclesPerMicrosecond())
+#endif
+
+struct PluginProfile
+{
+  unsigned long Calls; // times called
+  unsigned long Hits;  // times it returned true
+  unsigned long Early; // rejects within PLUGIN_EARLY_US
+  uint64_t Cycles;     // CPU cycles spent, all calls
+  unsigned long Max;   // CPU cycles of the slowest call
+};
+static PluginProfile Plugin_Profile[PLUGIN_COUNT];
+static PluginProfile PluginTX_Profile[PLUGIN_TX_COUNT];
+
+static void PluginProfileAdd(PluginProfile &Profile, boolean Hit, unsigned long Ticks)
+{
+  unsigned long Cycles = PROFILE_CYCLES(Ticks);
+
+  Profile.Calls++;
+  if (Hit)
+    Profile.Hits++;
+  else if (Cycles < PLUGIN_EARLY_US * clockCyclesPerMicrosecond())
+    Profile.Early++;
+  Profile.Cycles += Cycles;
+  if (Cycles > Profile.Max)
+    Profile.Max = Cycles;
+}
 #endif
 
+// Copies registry entry x out of flash
+static inline void PluginEntryAt(byte x, PluginEntry &Entry)
+{
+  memcpy_P(&Entry, &Plugins[x], sizeof(PluginEntry));
+}
+
+byte PluginId(byte x)
+{
+  return pgm_read_byte(&Plugins[x].Id);
+}
+
+// Plugins[] index of plugin Id, PluginCount if it is not compiled in
+static byte PluginIndexOf(byte Id)
+{
+  byte x = 0;
+
+  while (x < PluginCount && PluginId(x) != Id)
+    x++;
+  return x;
+}
+
+// Description of Plugins[x], a string in flash for the _P string functions (can exceed dbuffer of display_Name())
+const char *PluginDescription(byte x)
+{
+  PluginEntry Entry;
+
+  PluginEntryAt(x, Entry);
+  if (Entry.Description == NULL)
+    return PSTR(""); // left out on the Uno
+  return Entry.Description;
+}
+
+#ifdef PLUGIN_ADAPTIVE_ORDER
+// Calling group of Plugins[x]: 001 runs first and 250 and up (debug, unknown packets) last, whatever their hits
+static byte PluginGroup(byte x)
+{
+  byte Id = PluginId(x);
+
+  return (Id == 1) ? 0 : (Id >= 250) ? 2 : 1;
+}
+
+// Insertion sort of Plugin_Order on group, then most hits, then registry order
+static void PluginReorder()
+{
+  for (byte i = 1; i < PluginCount; i++)
+  {
+    byte x = Plugin_Order[i];
+    byte Group = PluginGroup(x);
+    byte j = i;
+
+    for (; j > 0; j--)
+    {
+      byte y = Plugin_Order[j - 1];
+      byte GroupY = PluginGroup(y);
+
+      if (GroupY < Group || (GroupY == Group && (Plugin_Hits[y] > Plugin_Hits[x] || (Plugin_Hits[y] == Plugin_Hits[x] && y < x))))
+        break;
+      Plugin_Order[j] = y;
+    }
+    Plugin_Order[j] = x;
+  }
+  for (byte x = 0; x < PluginCount; x++)
+    Plugin_Hits[x] >>= 1;
+}
+#endif
+
+/*********************************************************************************************\
+ * Receive plugins switched off with 10;PLUGIN=xx;OFF;
+ * Saved as one bit per plugin id (so a build with other plugins keeps them) behind a magic
+ * word, in EEPROM on AVR and ESP8266 and in NVS (Preferences) on ESP32.
+ \*********************************************************************************************/
+static byte Plugin_Off[(PLUGIN_COUNT + 7) / 8]; // bit per Plugins[] index
+
+struct PluginStateRecord
+{
+  uint16_t Magic;
+  byte Off[32]; // bit per plugin id
+};
+
+static boolean PluginStateRead(PluginStateRecord &Record)
+{
+#ifdef ESP32
+  Preferences Prefs;
+
+  Record.Magic = 0;
+  if (Prefs.begin("rflink", true))
+  {
+    Prefs.getBytes("plugins", &Record, sizeof(Record));
+    Prefs.end();
+  }
+#elif defined(ESP8266)
+  EEPROM.begin(PLUGIN_STATE_ADDRESS + sizeof(Record));
+  EEPROM.get(PLUGIN_STATE_ADDRESS, Record);
+  EEPROM.end();
+#else
+  EEPROM.get(PLUGIN_STATE_ADDRESS, Record);
+#endif
+  return (Record.Magic == PLUGIN_STATE_MAGIC);
+}
+
+static void PluginStateWrite()
+{
+  PluginStateRecord Record;
+
+  if (!PluginStateRead(Record))
+  { // first save, all plugins on
+    Record.Magic = PLUGIN_STATE_MAGIC;
+    memset(Record.Off, 0, sizeof(Record.Off));
+  }
+  for (byte x = 0; x < PluginCount; x++)
+  {
+    byte Id = PluginId(x);
+
+    if (Plugin_Off[x >> 3] & (1 << (x & 7)))
+      Record.Off[Id >> 3] |= 1 << (Id & 7);
+    else
+      Record.Off[Id >> 3] &= ~(1 << (Id & 7));
+  }
+#ifdef ESP32
+  Preferences Prefs;
+
+  Prefs.begin("rflink", false);
+  Prefs.putBytes("plugins", &Record, sizeof(Record));
+  Prefs.end();
+#elif defined(ESP8266)
+  EEPROM.begin(PLUGIN_STATE_ADDRESS + sizeof(Record));
+  EEPROM.put(PLUGIN_STATE_ADDRESS, Record);
+  EEPROM.end(); // commits
+#else
+  EEPROM.put(PLUGIN_STATE_ADDRESS, Record); // only writes the bytes that changed
+#endif
+}
+
+// Switches plugin Id on or off and saves it, false if it is not compiled in or mandatory (001)
+boolean PluginSwitch(byte Id, boolean On)
+{
+  byte x = PluginIndexOf(Id);
+
+  if (x >= PluginCount || (Id == 1 && !On))
+    return false;
+  if (On)
+    Plugin_Off[x >> 3] &= ~(1 << (x & 7));
+  else
+    Plugin_Off[x >> 3] |= 1 << (x & 7);
+  PluginStateWrite();
+  return true;
+}
+
+// 20;XX;PLUGIN=004;ON;NewKaku;
+static void display_Plugin(byte x)
+{
+  char State[18];
+
+  display_Header();
+  sprintf_P(State, PSTR(";PLUGIN=%03u;%s"), PluginId(x), (Plugin_Off[x >> 3] & (1 << (x & 7))) ? "OFF" : "ON");
+  strcat(pbuffer, State);
+  strcat(pbuffer, ";"); // the description can be longer than display_Name() takes
+  strncat_P(pbuffer, PluginDescription(x), PRINT_BUFFER_SIZE - strlen(pbuffer) - 4);
+  display_Footer();
+}
+
+// Reply to 10;PLUGIN=xx;ON|OFF;
+void display_Plugin_State(byte Id)
+{
+  display_Plugin(PluginIndexOf(Id));
+}
+
+// 10;PLUGINS; one line per receive plugin
+void display_Plugin_States()
+{
+  for (byte x = 0; x < PluginCount; x++)
+  {
+    sendMsg();
+    display_Plugin(x);
+  }
+}
+
+/*********************************************************************************************/
+void PluginInit(void)
+{
+  PluginStateRecord Record;
+
+  // Restore the plugins switched off before the last reboot
+  if (PluginStateRead(Record))
+    for (byte x = 0; x < PluginCount; x++)
+      if (Record.Off[PluginId(x) >> 3] & (1 << (PluginId(x) & 7)))
+        Plugin_Off[x >> 3] |= 1 << (x & 7);
+
+#ifdef PLUGIN_ADAPTIVE_ORDER
+  for (byte x = 0; x < PluginCount; x++)
+    Plugin_Order[x] = x;
+#endif
+#ifdef PLUGIN_PULSE_INDEX
+  PluginEntry Entry;
+
+  // Index every plugin by the pulse count ranges (PROGMEM) it accepts, all rows if it has none
+  for (byte x = 0; x < PluginCount; x++)
+  {
+    PluginEntryAt(x, Entry);
+    for (int Row = 0; Row < PLUGIN_INDEX_ROWS; Row++)
+    {
+      const PulseRange *r = Entry.Pulses;
+      boolean Match = (r == NULL);
+
+      for (; !Match && pgm_read_word(&r->Max) != 0; r++)
+        Match = ((int)pgm_read_word(&r->Min) < (Row + 1) * PLUGIN_INDEX_STEP && (int)pgm_read_word(&r->Max) >= Row * PLUGIN_INDEX_STEP);
+      if (Match)
+        Plugin_Index[Row][x >> 3] |= 1 << (x & 7);
+    }
+  }
+#endif
+
+  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
+  PluginInitCall(0, 0);
+}
+/*********************************************************************************************/
+void PluginTXInit(void)
+{
   // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGINTX_INIT
   PluginTXInitCall(0, 0);
 }
@@ -2239,14 +1545,13 @@ void PluginTXInit(void)
  \*********************************************************************************************/
 byte PluginInitCall(byte Function, char *str)
 {
-  int x;
+  PluginEntry Entry;
 
-  for (x = 0; x < PLUGIN_MAX; x++)
+  for (byte x = 0; x < PluginCount; x++)
   {
-    if (Plugin_id[x] != 0)
-    {
-      Plugin_ptr[x](Function, str);
-    }
+    PluginEntryAt(x, Entry);
+    if (Entry.Decode == NULL)
+      Entry.Ptr(Function, str);
   }
   return true;
 }
@@ -2255,53 +1560,757 @@ byte PluginInitCall(byte Function, char *str)
  \*********************************************************************************************/
 byte PluginTXInitCall(byte Function, char *str)
 {
-  int x;
+  PluginTXEntry Entry;
+
+  for (byte x = 0; x < PluginTXCount; x++)
+  {
+    memcpy_P(&Entry, &PluginsTX[x], sizeof(PluginTXEntry));
+    Entry.Ptr(Function, str);
+  }
+  return true;
+}
+/*********************************************************************************************\
+ * Repeat check of a plugin with API v2 against Seen, the state the dispatcher handed in. SignalHash,
+ * SignalCRC(_1) and RepeatingTimer are left to the dispatcher: Plugin, CRC and CRC_1 go back to them.
+ \*********************************************************************************************/
+boolean PluginOutput::Repeat(unsigned long Bits, unsigned int Window)
+{
+  if (Plugin == Seen.Previous && Seen.Timer + Window >= millis() && CRC == Bits)
+    return true;
+  CRC = Bits; // not seen the RF packet recently
+  return false;
+}
+
+boolean PluginOutput::RepeatMixed(unsigned long Bits, unsigned int Window)
+{
+  if (Plugin == Seen.Previous && Seen.Timer + Window >= millis() && (CRC == Bits || CRC_1 == Bits))
+    return true;
+  CRC_1 = CRC; // the burst may alternate between two packets
+  CRC = Bits;
+  return false;
+}
+
+boolean PluginOutput::After(byte Plugin, unsigned int Window)
+{
+  if (Seen.Previous != Plugin || Seen.Timer + Window <= millis())
+    return false;
+  this->Plugin = Plugin;
+  CRC = Seen.CRC; // nothing remembered for this packet
+  return true;
+}
+
+// Repeat state of the dispatcher for the next API v2 call
+static void PluginSeen(RepeatState &Seen)
+{
+  Seen.Previous = SignalHashPrevious;
+  Seen.Timer = RepeatingTimer;
+  Seen.CRC = SignalCRC;
+  Seen.CRC_1 = SignalCRC_1;
+}
+#ifdef PLUGIN_MULTI_MATCH
+
+// Puts back a repeat state taken by PluginSeen()
+static void PluginRestore(const RepeatState &Seen)
+{
+  SignalHashPrevious = Seen.Previous;
+  RepeatingTimer = Seen.Timer;
+  SignalCRC = Seen.CRC;
+  SignalCRC_1 = Seen.CRC_1;
+}
+#endif
+
+/*********************************************************************************************\
+ * Adapter between the dispatcher and both plugin APIs. A v1 plugin (Ptr) reads RawSignal and writes
+ * pbuffer, so Packet must be RawSignal and Output pbuffer. It gets Function and str of PluginRXCall().
+ * A v2 plugin (Decode) only uses its arguments.
+ \*********************************************************************************************/
+static boolean PluginCall(const PluginEntry &Entry, const PacketView &Packet, PluginOutput &Output, byte Function, char *str)
+{
+  if (Entry.Decode == NULL)
+    return Entry.Ptr(Function, str);
 
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
+  boolean Decoded = Entry.Decode(Packet, Output);
+
+  SignalHash = Output.Plugin;
+  SignalCRC = Output.CRC;
+  SignalCRC_1 = Output.CRC_1;
+  if (Decoded)
+  {
+    RawSignal.Repeats = Output.Repeats;
+    RawSignal.Number = 0;
+  }
+  return Decoded;
+}
+
+// PluginCall() of Plugins[x], timed with PLUGIN_PROFILER
+static boolean PluginRun(byte x, const PluginEntry &Entry, const PacketView &Packet, PluginOutput &Output, byte Function, char *str)
+{
+#ifdef PLUGIN_PROFILER
+  unsigned long Start = PROFILE_CLOCK();
+  boolean Decoded = PluginCall(Entry, Packet, Output, Function, str);
+
+  if (!PluginRecount)
+    PluginProfileAdd(Plugin_Profile[x], Decoded, PROFILE_CLOCK() - Start);
+  return Decoded;
+#else
+  return PluginCall(Entry, Packet, Output, Function, str);
+#endif
+}
+
+#ifdef PLUGIN_PREFILTER
+/*********************************************************************************************\
+ * Summary of the packet in RawSignal for the plugin signatures, one pass over the pulses.
+ \*********************************************************************************************/
+static void SummarizeSignal(SignalSummary &Summary)
+{
+  RawPulse Longest = 0;
+  RawPulse Shortest = RAW_PULSE_MAX;
+
+  Summary.First = PULSE_TO_US(RawSignal.Pulses[1]);
+  Summary.SyncAt = 0;
+  for (int j = 1; j < RawSignal.Number; j++) // Pulses[RawSignal.Number] is the ending gap
   {
-    if (PluginTX_id[x] != 0)
+    if (RawSignal.Pulses[j] > Longest)
     {
-      PluginTX_ptr[x](Function, str);
+      Longest = RawSignal.Pulses[j];
+      Summary.SyncAt = j;
     }
+    if (RawSignal.Pulses[j] < Shortest)
+      Shortest = RawSignal.Pulses[j];
   }
+  Summary.Ratio = 0;
+  if (Longest > 0 && Shortest > 0)
+    Summary.Ratio = min(PULSE_TO_US(Longest) * 4 / PULSE_TO_US(Shortest), 255UL);
+}
+
+static boolean SignatureMatch(const PluginSignature *Signature, const SignalSummary &Summary)
+{
+  PluginSignature s;
+
+  if (Signature == NULL)
+    return true;
+  memcpy_P(&s, Signature, sizeof(PluginSignature));
+  if (s.FirstMax != 0 && (Summary.First < s.FirstMin || Summary.First > s.FirstMax))
+    return false;
+  if (s.SyncMax != 0 && (Summary.SyncAt < s.SyncMin || Summary.SyncAt > s.SyncMax))
+    return false;
+  if (s.RatioMax != 0 && Summary.Ratio != 0 && (Summary.Ratio < s.RatioMin || Summary.Ratio > s.RatioMax))
+    return false;
   return true;
 }
+
 /*********************************************************************************************\
- * With this function plugins are called that have Receive functionality. 
+ * Prefilter: one pass over all signatures, Pass gets a bit for every plugin worth calling and
+ * Missed one for every candidate its signature turned down. Candidates is the pulse count index
+ * row (NULL: all plugins).
  \*********************************************************************************************/
-byte PluginRXCall(byte Function, char *str)
+static void PluginPrefilter(const byte *Candidates, byte *Pass, byte *Missed)
+{
+  SignalSummary Summary;
+
+  SummarizeSignal(Summary);
+  for (byte x = 0; x < PluginCount; x++)
+  {
+    byte Bit = 1 << (x & 7);
+
+    if (x % 8 == 0)
+      Pass[x >> 3] = Missed[x >> 3] = 0;
+    if ((Candidates != NULL && !(Candidates[x >> 3] & Bit)) || (Plugin_Off[x >> 3] & Bit))
+      continue;
+    if (SignatureMatch((const PluginSignature *)pgm_read_ptr(&Plugins[x].Signature), Summary))
+      Pass[x >> 3] |= Bit;
+    else
+      Missed[x >> 3] |= Bit;
+  }
+}
+#endif
+#ifdef PLUGIN_MULTI_MATCH
+/*********************************************************************************************\
+ * Multi match: with MultiMatch on, PluginRXCall() goes on after a decode. RawSignal is restored
+ * for the next candidate and the first decode is kept to be reported as usual.
+ \*********************************************************************************************/
+struct PluginMatch
+{
+  byte x;
+  byte Score;   // 0..100: 50 for a checked decode + half of the timing quality
+  byte Jitter;  // mean distance of the pulses to their cluster centroid, % of the centroid
+  boolean Checked;
+};
+
+static RawSignalStruct MatchSignal; // RawSignal before the current call
+static PluginMatch Matches[PLUGIN_MATCH_MAX];
+static byte MatchCount;
+static struct // state left by the first decode
+{
+  char Line[PRINT_BUFFER_SIZE];
+  int Number;
+  byte Repeats;
+  byte Hash;
+  RepeatState Repeat;
+} Winner;
+
+// Timing error of MatchSignal in % (0 = every pulse on its centroid), the ending gap left out
+static byte SignalJitter()
+{
+  unsigned long Error = 0, Total = 0;
+
+  for (int j = 1; j < MatchSignal.Number; j++)
+  {
+    unsigned long Pulse = PULSE_TO_US(MatchSignal.Pulses[j]);
+    unsigned long Centroid = PULSE_TO_US(MatchSignal.Centroid[(MatchSignal.Symbols[j >> 2] >> ((j & 3) << 1)) & 3]);
+
+    Error += (Pulse > Centroid) ? Pulse - Centroid : Centroid - Pulse;
+    Total += Centroid;
+  }
+  return (Total == 0) ? 100 : min(Error * 100 / Total, 100UL);
+}
+
+// Keeps the first decode, then puts RawSignal, pbuffer and the repeat state (SignalHash, SignalHashPrevious,
+// RepeatingTimer, SignalCRC and SignalCRC_1) back as they were before the call: Seen, with SignalHash x
+static void PluginMatched(byte x, const PluginOutput &Output, byte Mark, const RepeatState &Seen)
+{
+  if (MatchCount == 0)
+  {
+    strcpy(Winner.Line, pbuffer);
+    Winner.Number = RawSignal.Number;
+    Winner.Repeats = RawSignal.Repeats;
+    Winner.Hash = SignalHash;
+    PluginSeen(Winner.Repeat);
+  }
+  if (MatchCount < PLUGIN_MATCH_MAX)
+  {
+    PluginMatch &Match = Matches[MatchCount++];
+    Match.x = x;
+    Match.Jitter = SignalJitter();
+    Match.Checked = Output.Checked;
+    Match.Score = (Output.Checked ? 50 : 0) + (100 - Match.Jitter) / 2;
+  }
+  memcpy(&RawSignal, &MatchSignal, sizeof(RawSignalStruct));
+  pbuffer[Mark] = 0;
+  SignalHash = x;
+  PluginRestore(Seen);
+}
+
+// Restores the first decode, with more matches one AMBIGUOUS line per match follows it:
+// 20;XX;AMBIGUOUS;PLUGIN=004;SCORE=..;CHECKED=..;JITTER=..;
+static void PluginMatchReport()
+{
+  strcpy(pbuffer, Winner.Line);
+  RawSignal.Number = Winner.Number;
+  RawSignal.Repeats = Winner.Repeats;
+  SignalHash = Winner.Hash;
+  PluginRestore(Winner.Repeat);
+  if (MatchCount < 2)
+    return;
+  PluginAmbiguous++;
+  for (byte m = 0; m < MatchCount; m++)
+  {
+    char Plugin[12];
+
+    sendMsg();
+    display_Header();
+    display_Name(PSTR("AMBIGUOUS"));
+    sprintf_P(Plugin, PSTR(";PLUGIN=%03u"), PluginId(Matches[m].x));
+    strcat(pbuffer, Plugin);
+    display_STAT(PSTR("SCORE"), Matches[m].Score);
+    display_STAT(PSTR("CHECKED"), Matches[m].Checked);
+    display_STAT(PSTR("JITTER"), Matches[m].Jitter);
+    display_Footer();
+  }
+}
+#endif
+
+// Bookkeeping after the decode of plugin x
+static void PluginDecoded(byte x)
+{
+  SignalHashPrevious = SignalHash; // store previous plugin number after success
+#ifdef PLUGIN_ADAPTIVE_ORDER
+  Plugin_Hits[x]++;
+  if (++Plugin_Decodes >= PLUGIN_REORDER_DECODES)
+  {
+    PluginReorder();
+    Plugin_Decodes = 0;
+  }
+#endif
+}
+#ifdef PLUGIN_SPLITTER
+/*********************************************************************************************\
+ * Splitter: a long packet is often one frame sent again and again with a short gap in between.
+ * The gaps are the pulses above 5/8 of the longest one. A sync is the run of pulses above half
+ * the longest one around a gap, so a jittered sync pulse next to it stays in the sync. A frame
+ * runs from the last pulse of a sync to the first pulse of the next sync, that pulse included.
+ * The frame length seen most often is the repeat period, only frames of that length are decoded.
+ \*********************************************************************************************/
+struct SignalFrame
+{
+  int Offset; // the frame is RawSignal.Pulses[Offset + 1..Offset + Number]
+  int Number;
+};
+
+static byte SplitSignal(SignalFrame *Frames, int &Period)
+{
+  RawPulse Longest = 0;
+  int Start = 0; // last pulse of the previous sync, 0 before the first sync
+  byte Count = 0;
+
+  for (int j = 1; j < RawSignal.Number; j++) // Pulses[RawSignal.Number] is the ending gap
+    if (RawSignal.Pulses[j] > Longest)
+      Longest = RawSignal.Pulses[j];
+
+  RawPulse Gap = Longest / 2 + Longest / 8;
+  RawPulse Sync = Longest / 2;
+
+  for (int j = 1; j <= RawSignal.Number && Count < SPLIT_FRAMES_MAX; j++)
+  {
+    if (RawSignal.Pulses[j] <= Gap)
+      continue;
+    int First = j; // first pulse of the sync
+    while (First > Start + 1 && RawSignal.Pulses[First - 1] > Sync)
+      First--;
+    if (Start > 0 && First - Start >= SPLIT_FRAME_MIN)
+    {
+      Frames[Count].Offset = Start;
+      Frames[Count].Number = First - Start;
+      Count++;
+    }
+    while (j < RawSignal.Number && RawSignal.Pulses[j + 1] > Sync)
+      j++; // rest of the sync
+    Start = j;
+  }
+
+  byte Best = 0;
+
+  Period = 0;
+  for (byte f = 0; f < Count; f++)
+  {
+    byte Seen = 0;
+
+    for (byte g = f; g < Count; g++)
+      if (Frames[g].Number == Frames[f].Number)
+        Seen++;
+    if (Seen > Best)
+    {
+      Best = Seen;
+      Period = Frames[f].Number;
+    }
+  }
+  return Count;
+}
+
+static boolean PulsesAccepted(const PulseRange *r, int Number)
+{
+  if (r == NULL)
+    return false; // takes any packet, not a frame decoder
+  for (; pgm_read_word(&r->Max) != 0; r++)
+    if ((int)pgm_read_word(&r->Min) <= Number && (int)pgm_read_word(&r->Max) >= Number)
+      return true;
+  return false;
+}
+
+// Every API v2 plugin that takes frames of the repeat period gets them in turn, as views into RawSignal
+static boolean PluginSplitCall()
 {
-  for (byte x = 0; x < PLUGIN_MAX; x++)
+  SignalFrame Frames[SPLIT_FRAMES_MAX];
+  PluginEntry Entry;
+  int Period;
+  byte Count = SplitSignal(Frames, Period);
+
+  if (Count == 0)
+    return false;
+  for (byte f = 0; f < Count; f++)
+    if (Frames[f].Number == Period && !PluginRecount)
+      PluginFrames++;
+  for (byte i = 0; i < PluginCount; i++)
   {
-    if ((Plugin_id[x] != 0) && (Plugin_State[x] >= P_Enabled))
+    byte x = PLUGIN_AT(i);
+
+    if (Plugin_Off[x >> 3] & (1 << (x & 7)))
+      continue;
+    PluginEntryAt(x, Entry);
+    if (Entry.Decode == NULL || !PulsesAccepted(Entry.Pulses, Period))
+      continue;
+    for (byte f = 0; f < Count; f++)
     {
+      if (Frames[f].Number != Period)
+        continue;
       SignalHash = x; // store plugin number
-      if (Plugin_ptr[x](Function, str))
+      if (!PluginRecount)
+        PluginCalls++;
+      PacketView Packet(RawSignal, Frames[f].Offset, Frames[f].Number);
+      RepeatState Seen;
+
+      PluginSeen(Seen);
+      PluginOutput Output(pbuffer, PKSequenceNumber, x, Seen);
+
+      if (PluginRun(x, Entry, Packet, Output, 0, 0)) // frames only go to API v2
       {
-        SignalHashPrevious = SignalHash; // store previous plugin number after success
+        PluginDecoded(x);
         return true;
       }
     }
   }
   return false;
 }
+#endif
+// Every receive plugin that may take RawSignal in turn, true after the first decode
+static boolean PluginRXDecode(byte Function, char *str)
+{
+  PluginEntry Entry;
+#ifdef PLUGIN_PULSE_INDEX
+  const byte *Candidates = Plugin_Index[min(RawSignal.Number, RAW_BUFFER_SIZE) / PLUGIN_INDEX_STEP];
+#elif defined(PLUGIN_PREFILTER)
+  const byte *Candidates = NULL;
+#endif
+#ifdef PLUGIN_PREFILTER
+  byte Pass[(PLUGIN_COUNT + 7) / 8];
+  byte Missed[(PLUGIN_COUNT + 7) / 8];
+#endif
+
+#ifdef PLUGIN_SPLITTER
+  if (RawSignal.Number >= SPLIT_MIN_PULSES && !RFDebug && !QRFDebug && PluginSplitCall())
+    return true; // a frame of a long packet was decoded
+#endif
+#ifdef PLUGIN_PREFILTER
+  PluginPrefilter(Candidates, Pass, Missed);
+#endif
+#ifdef PLUGIN_MULTI_MATCH
+  MatchCount = 0;
+#endif
+  for (byte i = 0; i < PluginCount; i++)
+  {
+    byte x = PLUGIN_AT(i);
+#ifdef PLUGIN_PREFILTER
+    if (!(Pass[x >> 3] & (1 << (x & 7))))
+    {
+      if ((Missed[x >> 3] & (1 << (x & 7))) && !PluginRecount)
+        PluginFiltered++; // here, not in PluginPrefilter(): it runs again after Plugin_001
+      continue;           // wrong pulse count, signature mismatch or switched off
+    }
+#else
+#ifdef PLUGIN_PULSE_INDEX
+    if (!(Candidates[x >> 3] & (1 << (x & 7))))
+      continue; // RawSignal.Number is none of this plugin's pulse counts
+#endif
+    if (Plugin_Off[x >> 3] & (1 << (x & 7)))
+      continue; // switched off by 10;PLUGIN=xx;OFF;
+#endif
+    int Number = RawSignal.Number;
+#ifdef PLUGIN_PREFILTER
+    RawPulse Hint = RawSignal.Pulses[0];
+#endif
+    PluginEntryAt(x, Entry);
+    SignalHash = x; // store plugin number
+    if (!PluginRecount)
+      PluginCalls++;
+    PacketView Packet(RawSignal);
+    RepeatState Seen;
+
+    PluginSeen(Seen);
+    PluginOutput Output(pbuffer, PKSequenceNumber, x, Seen);
+#ifdef PLUGIN_MULTI_MATCH
+    byte Mark = strlen(pbuffer);
+
+    if (MultiMatch)
+      memcpy(&MatchSignal, &RawSignal, sizeof(RawSignalStruct));
+#endif
+    if (PluginRun(x, Entry, Packet, Output, Function, str))
+    {
+#ifdef PLUGIN_MULTI_MATCH
+      if (MultiMatch)
+      {
+        PluginMatched(x, Output, Mark, Seen);
+        continue; // RawSignal is back as before the call, try the next candidate
+      }
+#endif
+      PluginDecoded(x);
+      return true;
+    }
+    if (RawSignal.Number != Number && RawSignal.Number > 0)
+    {
+      ClusterSignal(RawSignal); // packet was translated (Plugin_001), symbols must follow
+#ifdef PLUGIN_PULSE_INDEX
+      Candidates = Plugin_Index[min(RawSignal.Number, RAW_BUFFER_SIZE) / PLUGIN_INDEX_STEP];
+#endif
+    }
+#ifdef PLUGIN_PREFILTER
+    if (RawSignal.Number != Number || RawSignal.Pulses[0] != Hint)
+      PluginPrefilter(Candidates, Pass, Missed); // translated or hinted by Plugin_001
+#endif
+  }
+#ifdef PLUGIN_MULTI_MATCH
+  if (MatchCount > 0)
+  {
+    PluginMatchReport();
+    PluginDecoded(Matches[0].x);
+    return true;
+  }
+#endif
+  return false;
+}
+#ifdef PLUGIN_COMBINER
+/*********************************************************************************************\
+ * Combiner: a remote sends its packet 3..10 times, at the edge of the range every repeat may
+ * lose a pulse or two to noise while most of its pulses are right. The symbols of the packets
+ * no plugin decodes are kept for COMBINE_WINDOW_MS. Once COMBINE_VOTES repeats of the same
+ * length and timing clusters are in, each pulse takes the symbol most of them agree on and
+ * the plugins get the voted packet. A decode clears the kept packets.
+ \*********************************************************************************************/
+struct CombinePacket
+{
+  unsigned long Time;
+  int Number; // 0 = free
+  byte Clusters;
+  RawPulse Centroid[SIGNAL_CLUSTERS];
+  byte Symbols[(RAW_BUFFER_SIZE + 4) / 4];
+};
+
+static CombinePacket Combined[COMBINE_PACKETS];
+static RawSignalStruct CombineSignal; // RawSignal as received, back when the voted packet is not decoded either
+
+#define COMBINE_SYMBOL(s, x) (((s)[(x) >> 2] >> (((x)&3) << 1)) & 3)
+
+static void CombineClear()
+{
+  for (byte k = 0; k < COMBINE_PACKETS; k++)
+    Combined[k].Number = 0;
+}
+
+// Kept is a repeat of RawSignal: recent, same pulses, same clusters and few symbols apart
+static boolean CombineRepeat(const CombinePacket &Kept)
+{
+  int Differ = 0;
+
+  if (Kept.Number != RawSignal.Number || Kept.Clusters != RawSignal.Clusters || RawSignal.Time - Kept.Time > COMBINE_WINDOW_MS)
+    return false;
+  for (byte c = 0; c < Kept.Clusters; c++)
+  {
+    unsigned long Mean = PULSE_TO_US(RawSignal.Centroid[c]), Other = PULSE_TO_US(Kept.Centroid[c]);
+
+    if (((Mean > Other) ? Mean - Other : Other - Mean) > Mean / SIGNAL_CLUSTER_SPREAD)
+      return false;
+  }
+  for (int x = 1; x < RawSignal.Number; x++) // the ending gap left out
+    if (COMBINE_SYMBOL(Kept.Symbols, x) != PULSE_SYMBOL(x))
+      Differ++;
+  return Differ <= RawSignal.Number / COMBINE_DIFFER;
+}
+
+// Keeps RawSignal, votes it with its repeats and decodes the result. True after a decode
+static boolean PluginCombine(byte Function, char *str)
+{
+  byte Voters[COMBINE_PACKETS];
+  byte Count = 0, Slot = 0;
+  unsigned long Age = 0;
+
+  if (RawSignal.Number <= 0 || RawSignal.Clusters == 0)
+    return false;
+  for (byte k = 0; k < COMBINE_PACKETS; k++)
+  {
+    unsigned long Since = (Combined[k].Number == 0) ? 0xFFFFFFFFUL : RawSignal.Time - Combined[k].Time;
+
+    if (Since >= Age) // a free slot, else the oldest packet
+    {
+      Age = Since;
+      Slot = k;
+    }
+    if (Combined[k].Number != 0 && CombineRepeat(Combined[k]))
+      Voters[Count++] = k;
+  }
+
+  // ***   Vote pulse by pulse, a tie keeps the symbol of the current packet   ***
+  byte Voted[(RAW_BUFFER_SIZE + 4) / 4];
+  int Changed = 0;
+
+  memset(Voted, 0, sizeof(Voted));
+  if (Count + 1 >= COMBINE_VOTES)
+    for (int x = 1; x < RawSignal.Number; x++)
+    {
+      byte Mine = PULSE_SYMBOL(x), Best = Mine;
+      byte Votes[SIGNAL_CLUSTERS] = {0};
+
+      Votes[Mine]++;
+      for (byte v = 0; v < Count; v++)
+        Votes[COMBINE_SYMBOL(Combined[Voters[v]].Symbols, x)]++;
+      for (byte c = 0; c < SIGNAL_CLUSTERS; c++)
+        if (Votes[c] > Votes[Best])
+          Best = c;
+      Voted[x >> 2] |= Best << ((x & 3) << 1);
+      if (Best != Mine)
+        Changed++;
+    }
+
+  // ***   Keep the packet as received, in a free slot or over the oldest one   ***
+  CombinePacket &Kept = Combined[Slot];
+  Kept.Time = RawSignal.Time;
+  Kept.Number = RawSignal.Number;
+  Kept.Clusters = RawSignal.Clusters;
+  memcpy(Kept.Centroid, RawSignal.Centroid, sizeof(Kept.Centroid));
+  memcpy(Kept.Symbols, RawSignal.Symbols, sizeof(Kept.Symbols));
+  if (Changed == 0)
+    return false; // no vote, or the same packet that failed already
+
+  // ***   Outvoted pulses move to the centroid of their new symbol   ***
+  memcpy(&CombineSignal, &RawSignal, sizeof(RawSignalStruct));
+  for (int x = 1; x < RawSignal.Number; x++)
+  {
+    byte Symbol = COMBINE_SYMBOL(Voted, x);
+
+    if (Symbol != PULSE_SYMBOL(x))
+      RawSignal.Pulses[x] = RawSignal.Centroid[Symbol];
+  }
+  RawSignal.Pulses[0] = 0;
+  ClusterSignal(RawSignal);
+
+  byte Mark = strlen(pbuffer);
+  boolean Decoded;
+
+  PluginRecount = true; // the packet was counted by its first run
+  Decoded = PluginRXDecode(Function, str);
+  PluginRecount = false;
+  if (!Decoded)
+  {
+    memcpy(&RawSignal, &CombineSignal, sizeof(RawSignalStruct));
+    return false;
+  }
+  if (strlen(pbuffer) > Mark)
+    PluginRecovered++; // not counted when the plugin drops it as a repeat
+  CombineClear();
+  return true;
+}
+#endif
+/*********************************************************************************************\
+ * With this function plugins are called that have Receive functionality. 
+ \*********************************************************************************************/
+byte PluginRXCall(byte Function, char *str)
+{
+  PluginPackets++;
+  if (PluginRXDecode(Function, str))
+  {
+#ifdef PLUGIN_COMBINER
+    CombineClear(); // a repeat came through, nothing to recover
+#endif
+    return true;
+  }
+#ifdef PLUGIN_COMBINER
+  if (!RFDebug && !QRFDebug && PluginCombine(Function, str))
+    return true;
+#endif
+  return false;
+}
 /*********************************************************************************************\
  * With this function plugins are called that have Transmit functionality. 
  \*********************************************************************************************/
 byte PluginTXCall(byte Function, char *str)
 {
-  int x;
+  PluginTXEntry Entry;
+
+  for (byte x = 0; x < PluginTXCount; x++)
+  {
+    memcpy_P(&Entry, &PluginsTX[x], sizeof(PluginTXEntry));
+#ifdef PLUGIN_PROFILER
+    unsigned long Start = PROFILE_CLOCK();
+    boolean Sent = Entry.Ptr(Function, str);
+    PluginProfileAdd(PluginTX_Profile[x], Sent, PROFILE_CLOCK() - Start);
+    if (Sent)
+#else
+    if (Entry.Ptr(Function, str))
+#endif
+      return true;
+  }
+  return false;
+}
+/*********************************************************************************************\
+ * Receive plugins in calling order for 10;ORDER;, as many lines as needed.
+ * Each entry is the plugin id, with PLUGIN_ADAPTIVE_ORDER followed by its current hits.
+ \*********************************************************************************************/
+void display_Plugin_Order()
+{
+  char Entry[12];
 
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
+  display_Header();
+  display_Name(PSTR("ORDER"));
+  for (byte i = 0; i < PluginCount; i++)
   {
-    if (PluginTX_id[x] != 0)
+    byte x = PLUGIN_AT(i);
+
+#ifdef PLUGIN_ADAPTIVE_ORDER
+    sprintf_P(Entry, PSTR(";%03u=%u"), PluginId(x), Plugin_Hits[x]);
+#else
+    sprintf_P(Entry, PSTR(";%03u"), PluginId(x));
+#endif
+    if (strlen(pbuffer) + strlen(Entry) >= PRINT_BUFFER_SIZE - 4) // room left for the footer
     {
-      if (PluginTX_ptr[x](Function, str))
-      {
-        return true;
-      }
+      display_Footer();
+      sendMsg();
+      display_Header();
+      display_Name(PSTR("ORDER"));
     }
+    strcat(pbuffer, Entry);
   }
-  return false;
+  display_Footer();
+}
+/*********************************************************************************************\
+ * Decode statistics, second line of 10;STATS;
+ \*********************************************************************************************/
+void display_Decode_Stats()
+{
+  display_STAT(PSTR("REPEATS"), RepeatsDropped);
+  display_STAT(PSTR("PACKETS"), PluginPackets);
+  display_STAT(PSTR("CALLS"), PluginCalls); // CALLS / PACKETS = plugins tried per packet
+#ifdef PLUGIN_PREFILTER
+  display_STAT(PSTR("FILTERED"), PluginFiltered);
+#endif
+#ifdef PLUGIN_SPLITTER
+  display_STAT(PSTR("FRAMES"), PluginFrames);
+#endif
+#ifdef PLUGIN_COMBINER
+  display_STAT(PSTR("RECOVERED"), PluginRecovered);
+#endif
+#ifdef PLUGIN_MULTI_MATCH
+  display_STAT(PSTR("AMBIGUOUS"), PluginAmbiguous);
+#endif
+#ifdef PLUGIN_PROFILER
+  // One more line for every plugin that has been called: 20;XX;STATS;PLUGIN=004;CALLS=..;OK=..;EARLY=..;KCYCLES=..;MAX=..;
+  for (byte i = 0; i < PluginCount + PluginTXCount; i++)
+  {
+    boolean TX = (i >= PluginCount);
+    byte x = TX ? i - PluginCount : i;
+    PluginProfile &Profile = TX ? PluginTX_Profile[x] : Plugin_Profile[x];
+
+    if (Profile.Calls == 0)
+      continue;
+    display_Footer();
+    sendMsg();
+    display_Header();
+    display_Name(PSTR("STATS"));
+    display_STAT(TX ? PSTR("PLUGIN_TX") : PSTR("PLUGIN"), TX ? pgm_read_byte(&PluginsTX[x].Id) : PluginId(x));
+    display_STAT(PSTR("CALLS"), Profile.Calls);
+    display_STAT(PSTR("OK"), Profile.Hits);
+    display_STAT(PSTR("EARLY"), Profile.Early);
+    display_STAT(PSTR("KCYCLES"), (unsigned long)(Profile.Cycles / 1000));
+    display_STAT(PSTR("MAX"), Profile.Max);
+  }
+#endif
+}
+
+// 10;STATS;RESET;
+void reset_Decode_Stats()
+{
+  RepeatsDropped = 0;
+  PluginPackets = 0;
+  PluginCalls = 0;
+  PluginFiltered = 0;
+#ifdef PLUGIN_SPLITTER
+  PluginFrames = 0;
+#endif
+#ifdef PLUGIN_COMBINER
+  PluginRecovered = 0;
+#endif
+#ifdef PLUGIN_MULTI_MATCH
+  PluginAmbiguous = 0;
+#endif
+#ifdef PLUGIN_PROFILER
+  memset(Plugin_Profile, 0, sizeof(Plugin_Profile));
+  memset(PluginTX_Profile, 0, sizeof(PluginTX_Profile));
+#endif
 }
-/*********************************************************************************************/
\ No newline at end of file
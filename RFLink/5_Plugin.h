@@ -9,40 +9,228 @@
 #define Plugin_h
 
 #include <Arduino.h>
+#include "2_Signal.h"
+#include "4_Display.h"
 
-#define PLUGIN_MAX 84    // Maximum number of Receive plugins
-#define PLUGIN_TX_MAX 84 // Maximum number of Transmit plugins
+#define PLUGIN_PULSE_INDEX // Only call the plugins whose pulse count ranges match RawSignal.Number
+#if (defined(ESP32) || defined(ESP8266))
+#define PLUGIN_INDEX_STEP 4 // Pulse counts per index row, (RAW_BUFFER_SIZE / 4 + 1) rows of one bit per plugin
+#elif defined(ARDUINO_AVR_UNO)
+#define PLUGIN_INDEX_STEP 32
+#else
+#define PLUGIN_INDEX_STEP 16
+#endif
+
+// #define PLUGIN_ADAPTIVE_ORDER  // Call the plugins that decoded most packets lately first. 001 stays first, 250 and up last
+#define PLUGIN_REORDER_DECODES 32 // Decoded packets between two reorders
+
+// #define PLUGIN_PROFILER          // Count calls, decodes and CPU cycles per plugin, shown by 10;STATS;
+#define PLUGIN_EARLY_US 20          // A reject faster than this in uSec counts as EARLY (length or preamble check)
 
-enum PState
+// #define PLUGIN_MULTI_MATCH  // Allow 10;MULTIMATCH=ON;: try every candidate and report the frames more plugins accept
+#define PLUGIN_MATCH_MAX 6       // Matches kept per frame
+
+#define PLUGIN_SPLITTER      // Cut long packets at their sync gaps and hand the repeated frames to the API v2 plugins
+#define SPLIT_MIN_PULSES 160 // Shorter packets are only decoded as a whole
+#define SPLIT_FRAME_MIN 24   // Shortest frame in pulses, the ending gap included
+#define SPLIT_FRAMES_MAX 12  // Frames kept per packet
+
+#if (defined(ESP32) || defined(ESP8266))
+#define PLUGIN_COMBINER        // Vote the pulse symbols of repeats that no plugin decodes and decode the majority packet
+#endif
+#define COMBINE_PACKETS 4      // Undecoded packets kept, about 90 bytes each
+#define COMBINE_VOTES 3        // Packets in a vote, the current one included
+#define COMBINE_WINDOW_MS 1000 // Older packets are not repeats of the current one
+#define COMBINE_DIFFER 8       // Repeats differ in at most 1/8 of their pulses
+
+#define PLUGIN_STATE_ADDRESS 0     // EEPROM address of the plugins switched off by 10;PLUGIN=xx;OFF; (AVR, ESP8266)
+#define PLUGIN_STATE_MAGIC 0x5250  // Marks a valid record, change it to forget the saved states
+
+struct PulseRange // RawSignal.Number a plugin accepts, see Plugin_xxx_Pulses[]
 {
-    P_Forbidden,
-    P_Disabled,
-    P_Enabled,
-    P_Mandatory
+    int Min;
+    int Max;
 };
+#define PULSES_END {0, 0} // Closes a list of PulseRange
+
+#define PLUGIN_PREFILTER // Skip plugins whose Plugin_xxx_Signature does not match the packet summary
 
-extern boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-extern byte Plugin_id[PLUGIN_MAX];
-extern byte Plugin_State[PLUGIN_MAX];
-#ifndef ARDUINO_AVR_UNO // Optimize memory limite to 2048 bytes on arduino uno
-extern String Plugin_Description[PLUGIN_MAX];
+struct PluginSignature // Cheap checks on the packet summary (SignalSummary) before the decoder runs
+{
+    uint16_t FirstMin; // First pulse in uSec, FirstMax 0 = any
+    uint16_t FirstMax;
+    int SyncMin;       // Position of the longest pulse, the ending gap left out. SyncMax 0 = any
+    int SyncMax;
+    byte RatioMin;     // Longest / shortest pulse in 1/4 steps (8 = twice as long), the ending gap left out. RatioMax 0 = any
+    byte RatioMax;
+};
+
+struct SignalSummary // Filled once per packet for the signatures
+{
+    uint16_t First;
+    int SyncAt;
+    byte Ratio; // 0 = unknown, fewer than 2 pulses
+};
+
+struct PacketView // Read only packet for a receive plugin (API v2), RawSignal by default
+{
+    const RawPulse *Pulses; // Pulses[1..Number]
+    int Number;
+    RawPulse Hint;          // plugin hint (RawSignal.Pulses[0]) set by Plugin_001, 0 for a frame
+    int Offset;             // Pulses[1] is RawSignal.Pulses[Offset + 1]
+    byte Clusters;
+#ifdef SIGNAL_CLUSTERING
+    const RawPulse *Centroid;
+    const byte *Symbols;
+#else
+    mutable RawPulse Above; // Without SIGNAL_CLUSTERING symbol 1 is a pulse above the last SymbolAbove() threshold
 #endif
+    unsigned long Time;
+
+#ifdef SIGNAL_CLUSTERING
+    explicit PacketView(const RawSignalStruct &Signal)
+        : Pulses(Signal.Pulses), Number(Signal.Number), Hint(Signal.Pulses[0]), Offset(0), Clusters(Signal.Clusters),
+          Centroid(Signal.Centroid), Symbols(Signal.Symbols), Time(Signal.Time) {}
+    // Frame of Number pulses after Signal.Pulses[Offset], nothing is copied
+    PacketView(const RawSignalStruct &Signal, int Offset, int Number)
+        : Pulses(Signal.Pulses + Offset), Number(Number), Hint(0), Offset(Offset), Clusters(Signal.Clusters),
+          Centroid(Signal.Centroid), Symbols(Signal.Symbols), Time(Signal.Time) {}
+
+    // Cluster (0 = shortest) of Pulses[x], as PULSE_SYMBOL(x)
+    byte Symbol(int x) const
+    {
+        x += Offset;
+        return (Symbols[x >> 2] >> ((x & 3) << 1)) & 3;
+    }
+    // Symbols of the 4 pulses from RawSignal.Pulses[x] (x a multiple of 4), 2 bits each, the first pulse lowest
+    byte SymbolQuad(int x) const
+    {
+        return Symbols[x >> 2];
+    }
+    // Lowest symbol with a centroid above Threshold, as SymbolAbove()
+    byte SymbolAbove(RawPulse Threshold) const
+    {
+        byte Symbol = 0;
+        while (Symbol < Clusters && Centroid[Symbol] <= Threshold)
+            Symbol++;
+        return Symbol;
+    }
+#else
+    explicit PacketView(const RawSignalStruct &Signal)
+        : Pulses(Signal.Pulses), Number(Signal.Number), Hint(Signal.Pulses[0]), Offset(0), Clusters(2), Above(0), Time(Signal.Time) {}
+    PacketView(const RawSignalStruct &Signal, int Offset, int Number)
+        : Pulses(Signal.Pulses + Offset), Number(Number), Hint(0), Offset(Offset), Clusters(2), Above(0), Time(Signal.Time) {}
+
+    byte Symbol(int x) const
+    {
+        return Pulses[x] > Above;
+    }
+    byte SymbolQuad(int x) const
+    {
+        byte Quad = 0;
+        for (byte k = 0; k < 4; k++)
+        {
+            int p = x + k - Offset;
+            if (p >= 1 && p <= Number && Pulses[p] > Above)
+                Quad |= 1 << (k << 1);
+        }
+        return Quad;
+    }
+    byte SymbolAbove(RawPulse Threshold) const
+    {
+        Above = Threshold;
+        return 1;
+    }
+#endif
+};
 
-extern boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, char *); // Transmit plugins
-extern byte PluginTX_id[PLUGIN_TX_MAX];
-extern byte PluginTX_State[PLUGIN_TX_MAX];
+struct RepeatState // What the dispatcher remembers of the packets before, handed to a receive plugin (API v2)
+{
+    byte Previous;       // SignalHashPrevious: plugin of the last decode
+    unsigned long Timer; // RepeatingTimer: millis() of the last packet
+    unsigned long CRC;   // SignalCRC
+    unsigned long CRC_1; // SignalCRC_1
+};
+
+class PluginOutput : public DisplayLine // Output sink of a receive plugin (API v2)
+{
+public:
+    PluginOutput(char *Buffer, byte &Sequence, byte Plugin, const RepeatState &Seen)
+        : DisplayLine(Buffer, Sequence), Plugin(Plugin), CRC(Seen.CRC), CRC_1(Seen.CRC_1), Repeats(false), Checked(false), Seen(Seen) {}
+
+    boolean Repeat(unsigned long Bits, unsigned int Window);      // Bits seen less than Window mSec ago, remembers them if not
+    boolean RepeatMixed(unsigned long Bits, unsigned int Window); // Repeat() of a burst that mixes two packets, see CRC_1
+    boolean After(byte Plugin, unsigned int Window);         // Plugin decoded less than Window mSec ago, the packet is left to it
+
+    byte Plugin;         // SignalHash after the call
+    unsigned long CRC;   // SignalCRC after the call
+    unsigned long CRC_1; // SignalCRC_1 after the call
+    boolean Repeats;     // RawSignal.Repeats after a decode, true skips the repeats of the packet
+    boolean Checked;     // the decode passed a checksum or parity check, see PLUGIN_MULTI_MATCH
+    const RepeatState Seen; // state before the call, for repeat checks of their own
+};
+
+typedef boolean (*PluginDecoder)(const PacketView &, PluginOutput &);
+
+struct PluginEntry // Receive plugin in the registry (PROGMEM), see Plugins[]
+{
+    byte Id;
+    boolean (*Ptr)(byte, char *); // API v1: reads RawSignal, writes pbuffer, NULL with Decode
+    PluginDecoder Decode;         // API v2: gets the packet and the output, NULL with Ptr
+    const PulseRange *Pulses; // NULL: any pulse count
+    const PluginSignature *Signature; // NULL: always decode
+    const char *Description;  // Plugin_xxx_Desc[] in flash, see PluginDescription()
+};
+
+struct PluginTXEntry // Transmit plugin in the registry (PROGMEM), see PluginsTX[]
+{
+    byte Id;
+    boolean (*Ptr)(byte, char *);
+};
+
+extern const PluginEntry Plugins[];     // Receive plugins, in calling order
+extern const byte PluginCount;
+extern const PluginTXEntry PluginsTX[]; // Transmit plugins
+extern const byte PluginTXCount;
 
 extern boolean RFDebug;   // debug RF signals with plugin 001 (no decode)
 extern boolean QRFDebug;  // debug RF signals with plugin 001 but no multiplication (faster?, compact)
 extern boolean RFUDebug;  // debug RF signals with plugin 254 (decode 1st)
 extern boolean QRFUDebug; // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
-// Of all the devices that are compiled, the addresses are stored in a table so that you can jump to them
 void PluginInit(void);
 void PluginTXInit(void);
 byte PluginInitCall(byte Function, char *str);
 byte PluginTXInitCall(byte Function, char *str);
 byte PluginRXCall(byte Function, char *str);
 byte PluginTXCall(byte Function, char *str);
+byte PluginId(byte x);
+const char *PluginDescription(byte x);
+void display_Plugin_Order();
+boolean PluginSwitch(byte Id, boolean On);
+void display_Plugin_State(byte Id);
+void display_Plugin_States();
+void display_Decode_Stats();
+void reset_Decode_Stats();
+extern unsigned long PluginPackets; // packets handed to PluginRXCall()
+extern unsigned long PluginCalls;   // receive plugins called for them
+extern unsigned long PluginFiltered; // calls saved by the signatures
+#if (defined(PLUGIN_COMBINER) && !defined(SIGNAL_CLUSTERING))
+#error "PLUGIN_COMBINER needs SIGNAL_CLUSTERING"
+#endif
+#if (defined(PLUGIN_MULTI_MATCH) && !defined(SIGNAL_CLUSTERING))
+#error "PLUGIN_MULTI_MATCH needs SIGNAL_CLUSTERING, its JITTER is measured against the clusters"
+#endif
+
+#ifdef PLUGIN_SPLITTER
+extern unsigned long PluginFrames;   // frames cut from long packets by the splitter
+#endif
+#ifdef PLUGIN_COMBINER
+extern unsigned long PluginRecovered; // packets decoded from the vote of their repeats
+#endif
+#ifdef PLUGIN_MULTI_MATCH
+extern boolean MultiMatch;           // 10;MULTIMATCH=ON;
+extern unsigned long PluginAmbiguous; // frames accepted by more than one plugin
+#endif
 
 #endif
\ No newline at end of file
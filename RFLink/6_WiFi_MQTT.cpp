@@ -153,7 +153,11 @@ void setup_MQTT()
 void callback(char *topic, byte *payload, unsigned int length)
 {
   payload[length] = 0;
+#ifdef RF_TASKS_ENABLED
+  postCommand((char *)payload); // Commands run in the decode task
+#else
   CheckMQTT(payload);
+#endif
 }
 
 void reconnect()
@@ -207,13 +211,13 @@ void reconnect()
   }
 }
 
-void publishMsg()
+void publishMsg(const char *msg)
 {
   static boolean MQTT_RETAINED = MQTT_RETAINED_0;
 
   if (!MQTTClient.connected())
     reconnect();
-  MQTTClient.publish(MQTT_TOPIC_OUT.c_str(), pbuffer, MQTT_RETAINED);
+  MQTTClient.publish(MQTT_TOPIC_OUT.c_str(), msg, MQTT_RETAINED);
 }
 
 void checkMQTTloop()
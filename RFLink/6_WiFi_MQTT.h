@@ -25,7 +25,7 @@ void start_WIFI();
 void stop_WIFI();
 void setup_MQTT();
 void reconnect();
-void publishMsg();
+void publishMsg(const char *);
 void checkMQTTloop();
 
 #else // MQTT_ENABLED
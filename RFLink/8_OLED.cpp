@@ -53,7 +53,7 @@ void splash_OLED()
     u8x8.setPowerSave(0);
 }
 
-void print_OLED()
+void print_OLED(char *msg)
 {
     /*
     static char delim[2] = ";";
@@ -76,8 +76,8 @@ void print_OLED()
     }
 */
     u8x8log.print('\f');
-    replacechar(pbuffer, ';', '\n');
-    u8x8log.print(pbuffer);
+    replacechar(msg, ';', '\n');
+    u8x8log.print(msg);
 }
 
 #endif // OLED_ENABLED
\ No newline at end of file
@@ -0,0 +1,266 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "9_Demod.h"
+
+class DemodWriter // Appends to a DemodBits, a byte at a time. Out.Count moves at Done() only
+{
+public:
+  explicit DemodWriter(DemodBits &Out)
+      : Out(Out), At(Out.Count >> 3), Used(Out.Count & 7), Acc(Used ? Out.Bytes[At] >> (8 - Used) : 0) {}
+
+  inline void Add(byte Bits, byte Count = 1) __attribute__((always_inline)) // Count (8 max) bits, first one highest, no branch on them
+  {
+    Acc = (Acc << Count) | Bits;
+    Used += Count;
+    if (Used >= 8)
+    {
+      Used -= 8;
+      Out.Bytes[At++] = Acc >> Used;
+    }
+  }
+  void Done(byte Bits)
+  {
+    if (Used)
+      Out.Bytes[At] = Acc << (8 - Used);
+    Out.Count += Bits;
+  }
+
+private:
+  DemodBits &Out;
+  byte At;
+  byte Used; // bits in Acc, not stored yet
+  unsigned int Acc;
+};
+
+unsigned long DemodBits::Get(byte First, byte Bits) const
+{
+  unsigned long Value = 0L;
+  byte x = First;
+
+  for (; Bits && (x & 7); x++, Bits--) // up to a byte boundary
+    Value = (Value << 1) | Bit(x);
+  for (; Bits >= 8; x += 8, Bits -= 8) // whole bytes
+    Value = (Value << 8) | Bytes[x >> 3];
+  for (; Bits; x++, Bits--)
+    Value = (Value << 1) | Bit(x);
+  return Value;
+}
+
+// Symbol of the 4 pulses, long = 1 and the first pulse highest, 0xFF if none
+static const byte DemodTristateCode[16] PROGMEM = {
+    0xFF, 0xFF, 0xFF, 0xFF, DEMOD_TRI_S, DEMOD_TRI_0, DEMOD_TRI_F, 0xFF,
+    0xFF, 0xFF, DEMOD_TRI_1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+int Demod_Tristate(const PacketView &Packet, int First, byte Symbols, const DemodTiming &Timing, DemodBits &Out)
+{
+  if (First + 4 * Symbols - 1 > Packet.Number || Out.Count + 2 * Symbols > DEMOD_BITS_MAX)
+    return 0;
+
+  const RawPulse *Pulse = Packet.Pulses + First;
+  const RawPulse Mid = Timing.Mid, ShortMin = Timing.ShortMin, ShortMax = DEMOD_LIMIT(Timing.ShortMax);
+  const RawPulse Span = DEMOD_LIMIT(Timing.LongMax) - ShortMin;      // ShortMin..LongMax
+  const RawPulse Gap = (ShortMax < Mid) ? Mid - ShortMax : 0;        // ShortMax + 1..Mid, neither short nor long
+  DemodWriter Writer(Out);
+
+  for (byte n = 0; n < Symbols; n++, Pulse += 4)
+  {
+    // A wrapped difference checks a window in one compare, only for the patterns of a symbol
+#define DEMOD_TRI_BAD(Length) (((RawPulse)((Length)-ShortMin) > Span) | ((RawPulse)((Length)-ShortMax - 1) < Gap))
+    byte Pattern = ((Pulse[0] > Mid) << 3) | ((Pulse[1] > Mid) << 2) | ((Pulse[2] > Mid) << 1) | (Pulse[3] > Mid);
+    byte Code = pgm_read_byte(DemodTristateCode + Pattern);
+
+    if (Code == 0xFF || DEMOD_TRI_BAD(Pulse[0]) || DEMOD_TRI_BAD(Pulse[1]) || DEMOD_TRI_BAD(Pulse[2]) || DEMOD_TRI_BAD(Pulse[3]))
+      return 0; // not a tristate symbol, a pulse out of its window or between ShortMax and Mid
+#undef DEMOD_TRI_BAD
+    Writer.Add(Code, 2);
+  }
+  Writer.Done(2 * Symbols);
+  return First + 4 * Symbols;
+}
+
+// Biphase: entry of a state (a short pulse waiting for its pair) and 4 pulses (long = 1, first pulse lowest).
+// Bits 0-3 the bits found (first one highest), 4-6 their count, 7 the new state, 8 a bad pulse after them
+static const uint16_t DemodBiphaseTable[32] PROGMEM = {
+    0x023, 0x0A1, 0x180, 0x031, 0x0A2, 0x190, 0x180, 0x0B0,
+    0x191, 0x032, 0x180, 0x1A0, 0x034, 0x190, 0x180, 0x040,
+    0x0A3, 0x180, 0x035, 0x180, 0x191, 0x180, 0x0B4, 0x180,
+    0x036, 0x180, 0x1A2, 0x180, 0x191, 0x180, 0x048, 0x180};
+
+// Biphase bits of Count pulses, bit Start and up of Map (1 = long)
+static int DemodBiphaseMap(const byte *Map, int Start, int Count, byte Flags, byte MaxBits, DemodBits &Out)
+{
+  if (MaxBits > DEMOD_BITS_MAX - Out.Count)
+    MaxBits = DEMOD_BITS_MAX - Out.Count;
+
+  byte Invert = (Flags & DEMOD_INVERT) ? 0x0F : 0;
+  byte Half = 0;
+  byte Bits = 0;
+  int x = Start;
+  DemodWriter Writer(Out);
+
+  for (; Count >= 4; Count -= 4, x += 4)
+  {
+    byte Nibble = ((Map[x >> 3] | (Map[(x >> 3) + 1] << 8)) >> (x & 7)) & 0x0F;
+    uint16_t Entry = pgm_read_word(DemodBiphaseTable + ((Half << 4) | Nibble));
+    byte Found = (Entry >> 4) & 7;
+
+    if (Bits + Found >= MaxBits)
+    { // enough bits, the rest is not looked at
+      byte Skip = Found - (MaxBits - Bits);
+      Found -= Skip;
+      Writer.Add(((Entry ^ Invert) >> Skip) & ((1 << Found) - 1), Found);
+      Writer.Done(MaxBits);
+      return 1;
+    }
+    if (Entry & 0x100)
+      return 0; // a short pulse without its pair
+    Writer.Add((Entry ^ Invert) & ((1 << Found) - 1), Found);
+    Bits += Found;
+    Half = (Entry >> 7) & 1;
+  }
+
+  for (; Count > 0 && Bits < MaxBits; Count--, x++)
+  { // last pulses, one at a time
+    if ((Map[x >> 3] >> (x & 7)) & 1)
+    {
+      if (Half)
+        return 0; // a short pulse without its pair
+      Writer.Add(Invert & 1);
+      Bits++;
+    }
+    else if (Half)
+    {
+      Writer.Add((Invert & 1) ^ 1);
+      Bits++;
+      Half = 0;
+    }
+    else
+      Half = 1;
+  }
+  Writer.Done(Bits);
+  return 1;
+}
+
+// Long pulses (symbol >= Long) of a byte of 4 symbols, the first pulse lowest
+static inline byte DemodLongNibble(byte Symbols, byte Long)
+{
+  byte Bits;
+
+  if (Long <= 1)
+    Bits = Long ? (Symbols | (Symbols >> 1)) & 0x55 : 0x55;
+  else if (Long == 2)
+    Bits = (Symbols >> 1) & 0x55;
+  else
+    Bits = (Long == 3) ? Symbols & (Symbols >> 1) & 0x55 : 0;
+  Bits = (Bits | (Bits >> 1)) & 0x33;
+  return (Bits | (Bits >> 2)) & 0x0F;
+}
+
+int Demod_BiphaseSymbols(const PacketView &Packet, int First, int Last, byte Long, byte Flags, byte MaxBits, DemodBits &Out)
+{
+  if (First < 1 || Last > Packet.Number || Last < First)
+    return 0;
+
+  byte Map[(RAW_BUFFER_SIZE + 16) / 8]; // bit x: pulse Base + x is long
+  int Base = (First + Packet.Offset) & ~3;   // SymbolQuad() has 4 pulses a byte
+  int End = Last + Packet.Offset;
+  int n = 0;
+
+  for (int x = Base; x <= End; x += 4, n++)
+  {
+    byte Nibble = DemodLongNibble(Packet.SymbolQuad(x), Long);
+    if (n & 1)
+      Map[n >> 1] |= Nibble << 4;
+    else
+      Map[n >> 1] = Nibble;
+  }
+  if (n & 1)
+    n++;
+  Map[n >> 1] = 0;
+
+  return DemodBiphaseMap(Map, First + Packet.Offset - Base, Last - First + 1, Flags, MaxBits, Out) ? Last + 1 : 0;
+}
+
+// Nibble reflected (LSB first) in bits 0-3, its parity in bit 4
+static const byte DemodNibble[16] PROGMEM = {
+    0x00, 0x18, 0x14, 0x0C, 0x12, 0x0A, 0x06, 0x1E, 0x11, 0x09, 0x05, 0x1D, 0x03, 0x1B, 0x17, 0x0F};
+
+int Demod_Bytes(const DemodBits &Bits, byte First, byte Flags, byte *Data, byte Count)
+{
+  byte Size = (Flags & DEMOD_PARITY) ? 9 : 8;
+  byte n = 0;
+
+  for (; n < Count && First + Size <= Bits.Count; n++, First += Size)
+  {
+    unsigned int Value = Bits.Get(First, Size);
+    byte Byte = (Flags & DEMOD_PARITY) ? Value >> 1 : Value;
+    byte High = pgm_read_byte(DemodNibble + (Byte >> 4));
+    byte Low = pgm_read_byte(DemodNibble + (Byte & 0x0F));
+
+    if ((Flags & DEMOD_PARITY) && (((High ^ Low) >> 4) != (Value & 1)))
+      return -1; // parity error
+    Data[n] = (Flags & DEMOD_LSB) ? (byte)((Low << 4) | (High & 0x0F)) : Byte;
+  }
+  return n;
+}
+
+unsigned int Demod_Clock(const PacketView &Packet, int First, int Last, DemodSpan *Span)
+{
+  if (First < 1 || Last > Packet.Number || Last < First)
+    return 0;
+
+  RawPulse Low = Packet.Pulses[First], High = 0;
+  unsigned long Shortest, Sum = 0;
+  unsigned int Count = 0;
+
+  for (int x = First + 1; x <= Last; x++)
+    if (Packet.Pulses[x] < Low)
+      Low = Packet.Pulses[x];
+  Shortest = PULSE_TO_US(Low);
+  for (int x = First; x <= Last; x++)
+  {
+    unsigned long Length = PULSE_TO_US(Packet.Pulses[x]);
+
+    if (Length < 2 * Shortest)
+    { // a 1T pulse
+      Sum += Length;
+      Count++;
+    }
+    else if (Packet.Pulses[x] > High)
+      High = Packet.Pulses[x]; // the longest pulse is a long one, unless there is none
+  }
+  if (Span != NULL)
+  {
+    if (High == 0) // only 1T pulses
+      for (int x = First; x <= Last; x++)
+        High = max(High, Packet.Pulses[x]);
+    Span->Shortest = Shortest;
+    Span->Longest = PULSE_TO_US(High);
+  }
+  return Count ? Sum / Count + RAWSIGNAL_SAMPLE_RATE / 2 : 0; // a stored pulse is the lower edge of its step
+}
+
+RawPulse Demod_ClockScale(RawPulse Nominal, unsigned int NominalT, unsigned int T, const DemodSpan &Span, byte RatioMin, byte RatioMax)
+{
+#ifdef DEMOD_CLOCK_RECOVERY
+  if (T < NominalT / 2 || T > 2 * NominalT)
+    return Nominal; // too far off, or no period found
+  if (Span.Longest < (unsigned long)RatioMin * T || Span.Longest > (unsigned long)RatioMax * T)
+    return Nominal; // long pulses of another protocol, T is not this one's period
+  if (T + NominalT / 8 < NominalT)
+    T += NominalT / 8; // the fixed threshold already takes 1/8 of drift, only the rest moves it
+  else if (T > NominalT + NominalT / 8)
+    T -= NominalT / 8;
+  else
+    return Nominal; // jitter of a packet at the nominal rate, not a drift
+  return PULSE_US(PULSE_TO_US(Nominal) * T / NominalT);
+#else
+  return Nominal;
+#endif
+}
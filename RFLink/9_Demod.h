@@ -0,0 +1,231 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Demod_h
+#define Demod_h
+
+#include <Arduino.h>
+#include "5_Plugin.h"
+
+// Pulses to bits for the receive plugins. Every call returns the index of the first pulse it did not use,
+// 0 when a pulse is out of its window. PWM, PPM, Manchester and biphase shift their bits (first one highest)
+// into the caller's unsigned long, they are inline so the plugin's constant windows fold into its own loop.
+// Tristate and the biphase of the timing symbols fill a DemodBits, for packets longer than 32 bits
+
+#define DEMOD_BITS_MAX 144 // Bits a DemodBits holds, 16 bytes with a parity bit each
+#define DEMOD_CLOCK_RECOVERY // Move the thresholds of the KAKU family plugins to the period measured in each packet
+
+struct DemodBits // Demodulated bits, packed first bit first (bit 0 is the MSB of Bytes[0]), bits past Count undefined
+{
+    byte Bytes[DEMOD_BITS_MAX / 8];
+    byte Count;
+
+    DemodBits() : Count(0) {}
+    void Clear() { Count = 0; }
+    byte Bit(byte x) const { return (Bytes[x >> 3] >> (7 - (x & 7))) & 1; }
+    unsigned long Get(byte First, byte Bits) const; // Bits (32 max) from bit First, the first one highest
+};
+
+struct DemodTiming // Pulse windows, PULSE_US() values. A limit of 0 is not checked
+{
+    RawPulse Mid;      // short <= Mid < long
+    RawPulse ShortMin; // shortest short pulse
+    RawPulse ShortMax; // longest short pulse (PPM, tristate, biphase). PWM, Manchester: the pulse pairing with the bit one
+    RawPulse LongMax;  // longest long pulse
+    RawPulse MarkMax;  // longest pulse between two bits (PPM)
+};
+
+#define DEMOD_SECOND 0x01 // PWM: the second pulse of a pair carries the bit
+#define DEMOD_INVERT 0x02 // PWM, PPM: a long pulse is a 0. Biphase: a long pulse is a 1
+#define DEMOD_PARITY 0x08 // Bytes: each byte is followed by an even parity bit
+#define DEMOD_LSB 0x10    // Bytes: each byte is sent LSB first
+
+#define DEMOD_LIMIT(Max) ((Max) ? (Max) : (RawPulse)~0) // a limit of 0 is not checked
+
+#define DEMOD_TRI_0 0 // Tristate symbols, short-long-short-long. Their 2 bits are those of the ARC packet identifier
+#define DEMOD_TRI_1 1 // long-short-long-short
+#define DEMOD_TRI_F 2 // short-long-long-short
+#define DEMOD_TRI_S 3 // short-long-short-short, the short 0 of the ARC group commands
+
+// Symbols of 4 pulses from Pulses[First] (PT2262), 2 bits each: DEMOD_TRI_0, DEMOD_TRI_1, DEMOD_TRI_F or DEMOD_TRI_S
+int Demod_Tristate(const PacketView &Packet, int First, byte Symbols, const DemodTiming &Timing, DemodBits &Out);
+// Biphase Pulses[First..Last] from the timing clusters, 4 pulses per table lookup: pulses of symbol Long and up are long,
+// see PacketView::SymbolAbove(). A long pulse is a 0, two short ones a 1. Stops after MaxBits bits, returns Last + 1 or 0
+int Demod_BiphaseSymbols(const PacketView &Packet, int First, int Last, byte Long, byte Flags, byte MaxBits, DemodBits &Out);
+// Count bytes from bit First, a nibble table reflects them (DEMOD_LSB) and checks their parity (DEMOD_PARITY).
+// Returns the bytes found, fewer when the bits run out, -1 on a parity error
+int Demod_Bytes(const DemodBits &Bits, byte First, byte Flags, byte *Data, byte Count);
+struct DemodSpan // Shortest and longest pulse in uSec
+{
+    unsigned int Shortest;
+    unsigned int Longest;
+};
+
+// Base period T in uSec of Pulses[First..Last], a preamble or sync of T and longer (2T and up) pulses:
+// the mean of the pulses shorter than twice the shortest one. 0 when First..Last is not in the packet.
+// Span, when given, gets the shortest and longest pulse of First..Last from the same walk
+unsigned int Demod_Clock(const PacketView &Packet, int First, int Last, DemodSpan *Span = NULL);
+// Threshold Nominal (a PULSE_US() value) of a protocol with a period of NominalT uSec, moved to the period T
+// of Demod_Clock() less 1/8 of NominalT: within 1/8 of NominalT it stays, so jitter alone never moves it.
+// A T under half or over twice NominalT is another protocol, not a drift: Nominal is returned. So it is when the packet
+// lacks the framing of the protocol, the longest pulse of Span (from the same Demod_Clock()) RatioMin..RatioMax times T
+RawPulse Demod_ClockScale(RawPulse Nominal, unsigned int NominalT, unsigned int T, const DemodSpan &Span, byte RatioMin, byte RatioMax);
+
+// Pairs of a long and a short pulse from Pulses[First], a long bit pulse is a 1. Bits (32 max) are shifted into Value.
+// The other pulse of a pair is short up to ShortMax and long from ShortMax (Mid when 0), a pulse of ShortMax is both
+inline int Demod_PWM(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, byte Flags, unsigned long &Value) __attribute__((always_inline));
+inline int Demod_PWM(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, byte Flags, unsigned long &Value)
+{
+    if (First < 1 || First + 2 * Bits - 1 > Packet.Number)
+        return 0; // the whole frame is checked here, not each pulse
+
+    const RawPulse *Pulse = Packet.Pulses + First;
+    const RawPulse Mid = Timing.Mid, ShortMin = Timing.ShortMin, LongMax = DEMOD_LIMIT(Timing.LongMax);
+    const RawPulse Pair = Timing.ShortMax ? Timing.ShortMax : Mid;
+    const byte Second = Flags & DEMOD_SECOND;
+    const byte Invert = (Flags & DEMOD_INVERT) ? 1 : 0;
+    unsigned long Acc = Value; // Value is only written when the bits are good
+
+    for (byte n = Bits; n; n--, Pulse += 2)
+    {
+        RawPulse Bit = Pulse[Second];
+        RawPulse Other = Pulse[Second ^ 1];
+
+        if (Bit > Mid)
+        {
+            if (Bit > LongMax || Other > Pair || Other < ShortMin)
+                return 0; // pulse too long, or not a long-short pair
+            Acc = (Acc << 1) | (Invert ^ 1);
+        }
+        else
+        {
+            if (Bit < ShortMin || Other < Pair)
+                return 0; // pulse too short, or not a short-long pair
+            Acc = (Acc << 1) | Invert;
+        }
+    }
+    Value = Acc;
+    return First + 2 * Bits;
+}
+
+// Bit pulse Pulses[First + 2n] followed by a mark, a long bit pulse is a 1. Bits (32 max) are shifted into Value
+inline int Demod_PPM(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, byte Flags, unsigned long &Value) __attribute__((always_inline));
+inline int Demod_PPM(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, byte Flags, unsigned long &Value)
+{
+    if (First < 1 || First + 2 * Bits - 1 > Packet.Number)
+        return 0;
+
+    const RawPulse *Pulse = Packet.Pulses + First;
+    const RawPulse Mid = Timing.Mid, ShortMin = Timing.ShortMin, ShortMax = DEMOD_LIMIT(Timing.ShortMax);
+    const RawPulse LongMax = DEMOD_LIMIT(Timing.LongMax), MarkMax = DEMOD_LIMIT(Timing.MarkMax);
+    const byte Invert = (Flags & DEMOD_INVERT) ? 1 : 0;
+    unsigned long Acc = Value; // Value is only written when the bits are good
+
+    for (byte n = Bits; n; n--, Pulse += 2)
+    {
+        if (Pulse[1] > MarkMax)
+            return 0; // mark too long
+
+        if (ShortMin == 0 && ShortMax == (RawPulse)~0)
+        { // no short window, constant once inlined: the bit is a compare and not a branch
+            if (Pulse[0] > LongMax)
+                return 0; // pulse too long
+            Acc = (Acc << 1) | ((Pulse[0] > Mid) ^ Invert);
+        }
+        else if (Pulse[0] > Mid)
+        {
+            if (Pulse[0] > LongMax)
+                return 0; // pulse too long
+            Acc = (Acc << 1) | (Invert ^ 1);
+        }
+        else
+        {
+            if (Pulse[0] > ShortMax || Pulse[0] < ShortMin)
+                return 0; // pulse out of the short window
+            Acc = (Acc << 1) | Invert;
+        }
+    }
+    Value = Acc;
+    return First + 2 * Bits;
+}
+
+// Half bits from Pulses[First]: two short pulses keep the last bit, a long one changes it. The bit before the first one
+// is the lowest bit of Value (start from 1 or 0), Bits (32 max) are shifted into it. The short pulse closing a pair may
+// be up to ShortMax (Mid when 0). Pulses[First..First + 2 * Bits - 1] must be in the packet, as if every bit took two
+inline int Demod_Manchester(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, unsigned long &Value) __attribute__((always_inline));
+inline int Demod_Manchester(const PacketView &Packet, int First, byte Bits, const DemodTiming &Timing, unsigned long &Value)
+{
+    if (First < 1 || First + 2 * Bits - 1 > Packet.Number)
+        return 0;
+
+    const RawPulse *Pulse = Packet.Pulses + First;
+    const RawPulse Mid = Timing.Mid, ShortMin = Timing.ShortMin, LongMax = DEMOD_LIMIT(Timing.LongMax);
+    const RawPulse Pair = Timing.ShortMax ? Timing.ShortMax : Mid;
+    unsigned long Acc = Value;
+
+    for (byte n = Bits; n; n--)
+    {
+        if (Pulse[0] > Mid)
+        { // long half bit pair
+            if (Pulse[0] > LongMax)
+                return 0; // pulse too long
+            Acc = (Acc << 1) | (~Acc & 1);
+            Pulse++;
+        }
+        else
+        { // two short half bits
+            if (Pulse[1] > Pair || Pulse[0] < ShortMin || Pulse[1] < ShortMin)
+                return 0; // invalid Manchester code, a short pulse comes in pairs
+            Acc = (Acc << 1) | (Acc & 1);
+            Pulse += 2;
+        }
+    }
+    Value = Acc;
+    return Pulse - Packet.Pulses;
+}
+
+// Biphase Pulses[First..Last]: a long pulse is a 0, two short ones a 1. Stops after MaxBits bits (32 kept in Value),
+// a short pulse left alone at the end is dropped. Returns the pulse after the last bit (Last + 1 at the end) or 0
+inline int Demod_Biphase(const PacketView &Packet, int First, int Last, const DemodTiming &Timing, byte Flags, byte MaxBits, unsigned long &Value) __attribute__((always_inline));
+inline int Demod_Biphase(const PacketView &Packet, int First, int Last, const DemodTiming &Timing, byte Flags, byte MaxBits, unsigned long &Value)
+{
+    if (First < 1 || Last > Packet.Number || Last < First)
+        return 0;
+
+    const RawPulse Mid = Timing.Mid, ShortMin = Timing.ShortMin, ShortMax = DEMOD_LIMIT(Timing.ShortMax), LongMax = DEMOD_LIMIT(Timing.LongMax);
+    const byte Invert = (Flags & DEMOD_INVERT) ? 1 : 0;
+    unsigned long Acc = Value;
+    byte Half = 0;
+    int x = First;
+
+    for (; x <= Last && MaxBits; x++)
+    {
+        RawPulse Length = Packet.Pulses[x];
+
+        if (Length > Mid)
+        {
+            if (Length > LongMax || Half)
+                return 0; // too long, or a short pulse without its pair
+            Acc = (Acc << 1) | Invert;
+            MaxBits--;
+        }
+        else if (Length > ShortMax || Length < ShortMin)
+            return 0;
+        else if (Half)
+        {
+            Acc = (Acc << 1) | (Invert ^ 1);
+            MaxBits--;
+            Half = 0;
+        }
+        else
+            Half = 1;
+    }
+    Value = Acc;
+    return x;
+}
+
+#endif // Demod_h
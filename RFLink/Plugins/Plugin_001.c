@@ -65,33 +65,35 @@
  * -------------------
  * Home Confort Smart Home - TEL-010 
  * The Home Confort remote sends the same RF packet at least 6 times over the air. The delay in between the re-transmits is too short to detect individual packets
- * So we break, filter and convert the Home Confort RF packets in this plugin
+ * PLUGIN_SPLITTER cuts them into frames for Plugin_011
  \*********************************************************************************************/
 #define P001_PLUGIN_ID 001
 #define PLUGIN_DESC_001 "Long Packet Translation and debugging"
 #define OVERSIZED_LIMIT 291 // longest packet is handled by plugin 48
 
-#define PULSE500 500 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE1100 1100 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE1600 1600 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE2000 2000 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE4000 4000 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE4200 4200 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE3300 3300 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE2500 2500 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE3000 3000 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE5000 5000 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE6000 6000 / RAWSIGNAL_SAMPLE_RATE
-#define PULSE6500 6500 / RAWSIGNAL_SAMPLE_RATE
+#define PULSE500 PULSE_US(500)
+#define PULSE1100 PULSE_US(1100)
+#define PULSE1600 PULSE_US(1600)
+#define PULSE2000 PULSE_US(2000)
+#define PULSE4000 PULSE_US(4000)
+#define PULSE4200 PULSE_US(4200)
+#define PULSE3300 PULSE_US(3300)
+#define PULSE2500 PULSE_US(2500)
+#define PULSE3000 PULSE_US(3000)
+#define PULSE5000 PULSE_US(5000)
+#define PULSE6000 PULSE_US(6000)
+#define PULSE6500 PULSE_US(6500)
 
 #ifdef PLUGIN_001
 #include "../4_Display.h"
 
+const char Plugin_001_Desc[] PROGMEM = PLUGIN_DESC_001;
+
 boolean Plugin_001(byte function, char *string)
 {
    // byte HEconversiontype = 1; // 0=No conversion, 1=conversion to Elro 58 pulse protocol (same as FA500R Method 1)
 
-   int i, j;
+   int i;
    // ==========================================================================
    // TEST
    // ==========================================================================
@@ -215,7 +217,7 @@ boolean Plugin_001(byte function, char *string)
       Serial.print(RawSignal.Number);         // print number of pulses
       Serial.print(F(";Pulses(uSec)="));      // print pulse durations
       // ----------------------------------
-      char dbuffer[3];
+      char dbuffer[5];
 
       for (i = 1; i < RawSignal.Number + 1; i++)
       {
@@ -226,7 +228,7 @@ boolean Plugin_001(byte function, char *string)
          }
          else
          {
-            Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
+            Serial.print(PULSE_TO_US(RawSignal.Pulses[i]));
             if (i < RawSignal.Number)
                Serial.write(',');
          }
@@ -237,55 +239,6 @@ boolean Plugin_001(byte function, char *string)
       return true;          // stop processing
    }
    
-   #ifdef PLUGIN_061
-   // ==========================================================================
-   // Beginning of Signal translation for Impuls
-   // ==========================================================================
-   // 20;D7;DEBUG;Pulses=250;Pulses(uSec)=275,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,350,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,75,325,75,350,375,25,75,4700,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,75,325,75,350,375,25,75;
-   // if ((RawSignal.Number == 250) || (RawSignal.Number == RAW_BUFFER_SIZE - 1))
-   // { // Impuls
-   //    if (RawSignal.Pulses[50] > PULSE4200)
-   //    {
-   //       if (RawSignal.Pulses[100] > PULSE4200)
-   //       {
-   //          if (RawSignal.Pulses[150] > PULSE4200)
-   //          {
-   //             RawSignal.Number = 50;    // New packet length
-   //             RawSignal.Pulses[0] = 61; // signal the plugin number that should process this packet
-   //             return false;             // packet detected, conversion done
-   //          }
-   //       }
-   //    }
-   // }
-   // ==========================================================================
-   // End of Signal translation
-   // ==========================================================================
-   #endif
-
-   #ifdef PLUGIN_011
-   // ==========================================================================
-   // Beginning of Signal translation for Home Confort Switches/Remotes
-   // ==========================================================================
-   // if (RawSignal.Number == 200)
-   // {
-   //    if (RawSignal.Pulses[1] > PULSE2000)
-   //    {
-   //       if (RawSignal.Pulses[100] > PULSE4000)
-   //       {
-   //          if (RawSignal.Pulses[101] > PULSE2000)
-   //          {
-   //             RawSignal.Number = 100;   // New packet length
-   //             RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
-   //             return false;             // packet detected, conversion done
-   //          }
-   //       }
-   //    }
-   // }
-   // ==========================================================================
-   // End of Signal translation
-   // ==========================================================================
-   #endif
-
    #ifdef PLUGIN_005
    // ==========================================================================
    // Beginning of Signal translation for Intertek Unitec Switches/Remotes
@@ -331,44 +284,10 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    #endif
 
-   #ifdef PLUGIN_037
-   // ==========================================================================
-   // Beginning of Signal translation for AcuRite 986 Sensors
-   // ==========================================================================
-   // Serial.print("RawSignal.Number: ");
-   // Serial.println(RawSignal.Number);  
-   if (RawSignal.Number > 160 && RawSignal.Number < 190)
-   {
-      for (j = 2; j < 43; j++)
-      { // Only check the total RF packet length we are looking for
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] < PULSE1100)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 84 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 84] > PULSE1100))
-            { // first long delay found, make sure we have another at the right position
-               if (j != 42)
-               {
-                  // Serial.print("RawSignal.Pulses: ");
-                  for (i = 0; i < 84; i++)
-                  {
-                     // Serial.print(RawSignal.Pulses[j + 1 + i]);
-                     // Serial.print(", ");
-                     RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-                  }
-                  // Serial.println("");
-               }
-               RawSignal.Number = 84;    // New packet length
-               RawSignal.Pulses[0] = 37; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-  // ==========================================================================
-  #endif
+   // **************************************************************************
+   // Repeated frames of AcuRite 986 (037), Auriol V2/Xiron (046), Atlantic (064), GARAGE640 (065),
+   // SelectPlus (070) and Byron SX (072) are cut out of long packets by PLUGIN_SPLITTER
+   // **************************************************************************
 
    // ==========================================================================
    // END plugin 001 if the incoming packet is not oversized and resume normal processing of plugins
@@ -514,8 +433,8 @@ boolean Plugin_001(byte function, char *string)
    // The long final pulse (6990 us) is truncated by the buffer size. 
    // ==========================================================================
 
-   #define PULSE600 600 / RAWSIGNAL_SAMPLE_RATE
-   #define PULSE700 700 / RAWSIGNAL_SAMPLE_RATE
+   #define PULSE600 PULSE_US(600)
+   #define PULSE700 PULSE_US(700)
 
    if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
    {
@@ -535,65 +454,6 @@ boolean Plugin_001(byte function, char *string)
    }
    #endif
 
-   #ifdef PLUGIN_065
-   // ==========================================================================
-   // Beginning of Signal translation for generic 24-bit keyfobs with length of
-   // the bit is 640us (two pulses per bit + one closing)
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      int start = 0; 
-      for (start = 52; start > 0; start--) {
-         if (RawSignal.Pulses[start] > PULSE4000) {
-            start++; //skip the first long delay
-            int end = start + 48 + 1; //48 is actual data
-            if (RawSignal.Pulses[end] < PULSE4000) break; // exit if no second delay
-            for (int i = start; i < end; i += 2) { //validate pulse periods
-               if (RawSignal.Pulses[i] + RawSignal.Pulses[i] > 700) {
-                  goto exit_065;
-               }
-            }
-            for (int i = 0; i < 48; i++) {
-               RawSignal.Pulses[1 + i] = RawSignal.Pulses[start + i]; // reorder pulse array
-            }
-            RawSignal.Number = 48;
-            RawSignal.Pulses[0] = 65;
-            return false;
-         }
-      }
-      exit_065:;
-   }
-   // ==========================================================================
-   #endif
-
-   #if (defined(PLUGIN_046) ||  defined(PLUGIN_064))
-   // ==========================================================================
-   // Beginning of Signal translation for Atlantic/Visonic alarm detectors
-   // 74 pulses sent 1, 4 or 5 times. Pulse 74 = 3968 (064)
-   // ==========================================================================
-   // ==========================================================================
-   // Also Beginning of Signal translation for Auriol & Xiro (046)
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (int offset = 0; offset < 74; offset++)
-      {
-         if (RawSignal.Pulses[offset + 74] > PULSE3300 && RawSignal.Pulses[offset + 74 * 2] > PULSE3300 && ((offset > 0 && RawSignal.Pulses[offset] > PULSE3300) || RawSignal.Pulses[offset + 74 * 3] > PULSE3300))
-         {
-            for (i = 0; i < 74; i++)
-            {
-               RawSignal.Pulses[1 + i] = RawSignal.Pulses[offset + i + 1]; // reorder pulse array
-            }
-            RawSignal.Number = 74; // New packet length
-            // RawSignal.Pulses[0] = 46; // signal the plugin number that should process this packet, unused for Auriol/Xiron
-            // RawSignal.Pulses[0] = 64; // signal the plugin number that should process this packet, unused for Atlantic/Visonic
-            return false; // Conversion done, stop plugin 1 and continue with regular plugins
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
-
    #ifdef PLUGIN_075
    // ==========================================================================
    // Beginning of Signal translation for Silvercrest Doorbell
@@ -622,52 +482,6 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    #endif
 
-   #ifdef PLUGIN_011
-   // ==========================================================================
-   // Beginning of Signal translation for Home Confort Switches/Remotes
-   // ==========================================================================
-   // if (RawSignal.Number > 299)
-   // { // Scan for corrupted/chained Home Confort RF packets
-   //    if (RawSignal.Pulses[1] > PULSE2000)
-   //    {
-   //       if (RawSignal.Pulses[100] > PULSE4000)
-   //       {
-   //          if (RawSignal.Pulses[101] > PULSE2000)
-   //          {
-   //             RawSignal.Number = 100;   // New packet length
-   //             RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
-   //             return false;             // packet detected, conversion done
-   //          }
-   //       }
-   //    }
-   //    for (j = 1; j < 104; j++)
-   //    {
-   //       //if (RawSignal.Pulses[j]*RawSignal.Multiply > 4000) {
-   //       if (RawSignal.Pulses[j] > PULSE4000)
-   //       {
-   //          //if (RawSignal.Pulses[j+1]*RawSignal.Multiply > 2000) {
-   //          if (RawSignal.Pulses[j + 1] > PULSE2000)
-   //          {
-   //             if ((j + 98) > RawSignal.Number)
-   //                break; // cant be the packet we are looking for
-   //             //if ( (RawSignal.Pulses[j+100]*RawSignal.Multiply > 4000) && (RawSignal.Pulses[j+101]*RawSignal.Multiply > 2000) ) { // This could be a Home Confort packet
-   //             if ((RawSignal.Pulses[j + 100] > PULSE4000) && (RawSignal.Pulses[j + 101] > PULSE2000))
-   //             { // This could be a Home Confort packet
-   //                for (i = 0; i < 100; i++)
-   //                {
-   //                   RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + i]; // relocate/reorder pulse array
-   //                }
-   //                RawSignal.Number = 100;   // New packet length
-   //                RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
-   //             }
-   //             return false; // Conversion done, stop plugin 1 and continue with regular plugins
-   //          }
-   //       }
-   //    }
-   // }
-   // ==========================================================================
-   #endif
-
    #ifdef PLUGIN_063
    // ==========================================================================
    // Beginning of Signal translation for Oregon
@@ -701,70 +515,6 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    #endif
 
-   #ifdef PLUGIN_070
-   // ==========================================================================
-   // Beginning of Signal translation for SelectPlus
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (j = 2; j < 37; j++)
-      { // Only check the total RF packet length we are looking for
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE5000)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 36 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 36] > PULSE5000) && (RawSignal.Pulses[j + 36 + 36] > PULSE5000))
-            { // first long delay found, make sure we have another at the right position
-               if (j != 36)
-               {
-                  for (i = 0; i < 36; i++)
-                  {
-                     RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-                  }
-               }
-               RawSignal.Number = 36;    // New packet length
-               RawSignal.Pulses[0] = 70; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
-
-   #ifdef PLUGIN_072
-   // ==========================================================================
-   // Beginning of Signal translation for Byron Doorbell
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (j = 2; j < 90 /*RawSignal.Number*/; j++)
-      { // Only check twice the total RF packet length we are looking for
-         // Byron SX
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE2500)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 26 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 26] > PULSE2500) && (RawSignal.Pulses[j + 26] < PULSE3000) && (RawSignal.Pulses[j + 26 + 26] > PULSE2500))
-            { // first long delay found, make sure we have another at the right position
-               for (i = 0; i < 26; i++)
-               {
-                  RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-               }
-               RawSignal.Number = 26;    // New packet length
-               RawSignal.Pulses[0] = 72; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
-
    // ==========================================================================
    // End of Signal translation
    // ==========================================================================
@@ -808,7 +558,7 @@ Plugin  Pulselength
 048     126-290
 060     26
 061     50
-065     49
+065     50
 070     36
 071     66
 072     26
@@ -72,17 +72,20 @@
 #define PLUGIN_DESC_002 "LaCrosse V2"
 #define LACROSSE_PULSECOUNT 104 // also handles 102 pulses!
 
-#define LACROSSE_MIDLO 1100 / RAWSIGNAL_SAMPLE_RATE
-#define LACROSSE_MIDHI 1480 / RAWSIGNAL_SAMPLE_RATE
+#define LACROSSE_MIDLO PULSE_US(1100)
+#define LACROSSE_MIDHI PULSE_US(1480)
 
-#define LACROSSE_PULSEMID 1000 / RAWSIGNAL_SAMPLE_RATE
+#define LACROSSE_PULSEMID PULSE_US(1000)
 
 #ifdef PLUGIN_002
 #include "../4_Display.h"
 
-boolean Plugin_002(byte function, char *string)
+const PulseRange Plugin_002_Pulses[] PROGMEM = {{LACROSSE_PULSECOUNT - 2, LACROSSE_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_002_Desc[] PROGMEM = PLUGIN_DESC_002;
+
+boolean Plugin_002(const PacketView &Packet, PluginOutput &Output)
 {
-   if ((RawSignal.Number != LACROSSE_PULSECOUNT) && (RawSignal.Number != (LACROSSE_PULSECOUNT - 2)))
+   if ((Packet.Number != LACROSSE_PULSECOUNT) && (Packet.Number != (LACROSSE_PULSECOUNT - 2)))
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 5x4=20 bits
@@ -100,14 +103,14 @@ boolean Plugin_002(byte function, char *string)
    //==================================================================================
    // Get all 52 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number + 1; x += 2)
+   for (byte x = 1; x < Packet.Number + 1; x += 2)
    {
-      if ((RawSignal.Pulses[x + 1] < LACROSSE_MIDLO) || (RawSignal.Pulses[x + 1] > LACROSSE_MIDHI))
+      if ((Packet.Pulses[x + 1] < LACROSSE_MIDLO) || (Packet.Pulses[x + 1] > LACROSSE_MIDHI))
       {
-         if ((x + 1) < RawSignal.Number) // in between pulse check
+         if ((x + 1) < Packet.Number) // in between pulse check
             return false;
       }
-      if (RawSignal.Pulses[x] > LACROSSE_PULSEMID)
+      if (Packet.Pulses[x] > LACROSSE_PULSEMID)
       {
          if (bitcounter < 20)
          {
@@ -132,7 +135,7 @@ boolean Plugin_002(byte function, char *string)
          }
       }
    }
-   if (RawSignal.Number == (LACROSSE_PULSECOUNT - 2))
+   if (Packet.Number == (LACROSSE_PULSECOUNT - 2))
       bitstream2 <<= 1; // add missing zero bit
    //==================================================================================
    // all bytes received, sort data, do sanity checks and make sure checksum is okay
@@ -168,14 +171,13 @@ boolean Plugin_002(byte function, char *string)
    checksum = checksum & 0xF;
    if (checksum != data[12])
       return false;
+   Output.Checked = true;
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[12]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently, save value for later
-   else
+   if (Output.Repeat(tmpval, 0))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -198,11 +200,11 @@ boolean Plugin_002(byte function, char *string)
       else // WS3600
          temperature -= 400;
       // ----------------------------------
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_TEMP(temperature);
-      display_Footer();
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.TEMP(temperature);
+      Output.Footer();
    }
    else if (sensortype == B0001) // Humidity
    {
@@ -210,11 +212,11 @@ boolean Plugin_002(byte function, char *string)
       if (humidity == 0) // Humidity should not be 0
          return false;
       // ----------------------------------
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_HUM(humidity, HUM_BCD);
-      display_Footer();
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.HUM(humidity, HUM_BCD);
+      Output.Footer();
    }
    else if (sensortype == B0010)
    { // Rain
@@ -230,11 +232,11 @@ boolean Plugin_002(byte function, char *string)
          rain /= 100;
       }
       // ----------------------------------
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_RAIN(rain);
-      display_Footer();
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.RAIN(rain);
+      Output.Footer();
    }
    else if (sensortype == B0011) // Wind Speed
    {
@@ -246,12 +248,12 @@ boolean Plugin_002(byte function, char *string)
       if ((data[0]) == 0x9) // WS2300
          windspeed /= 10;   // divide by 10
       // ----------------------------------
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_WINDIR(winddirection);
-      display_WINSP(windspeed);
-      display_Footer();
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.WINDIR(winddirection);
+      Output.WINSP(windspeed);
+      Output.Footer();
    }
    else if (sensortype == B1011) // Wind Gust
    {
@@ -262,31 +264,29 @@ boolean Plugin_002(byte function, char *string)
       if ((data[0]) == 0x9) // WS2300
          windgust /= 10;    // divide by 10
       // ----------------------------------
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_WINDIR(winddirection);
-      display_WINGS(windgust);
-      display_Footer();
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.WINDIR(winddirection);
+      Output.WINGS(windgust);
+      Output.Footer();
    }
    else
    {
-      display_Header();
-      display_Name(PSTR("LaCrosseV2"));
-      display_IDc(c_ID);
-      display_Name(PSTR(";DEBUG"));
+      Output.Header();
+      Output.Name(PSTR("LaCrosseV2"));
+      Output.IDc(c_ID);
+      Output.Name(PSTR(";DEBUG"));
       char dbuffer[3];
       for (byte i = 0; i < 12; i++)
       {
          sprintf(dbuffer, "%02x", data[i]);
-         Serial.print(dbuffer);
+         strcat(Output.Line, dbuffer);
       }
-      display_Footer();
+      Output.Footer();
       //return false;
    }
    //==================================================================================
-   RawSignal.Repeats = false;
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_002
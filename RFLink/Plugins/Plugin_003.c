@@ -219,210 +219,183 @@
 #define KAKU_PLUGIN_ID 003
 #define PLUGIN_DESC_003 "Kaku / AB400D / Impuls / PT2262 / Sartano / Tristate"
 #define KAKU_CodeLength 12                        // number of data bits
-#define KAKU_R 300 / RAWSIGNAL_SAMPLE_RATE        //360 // 300          // 370? 350 us
-#define KAKU_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE // (17)  510 = KAKU_R*2 not sufficient!
+#define KAKU_R PULSE_US(300)        //360 // 300          // 370? 350 us
+#define KAKU_PULSEMID PULSE_US(600) // (17)  510 = KAKU_R*2 not sufficient!
+#define KAKU_RX_T 280               // us, 1T that KAKU_PULSEMID is set for, it moves with the 1T of each packet
+#define KAKU_RX_LONGMIN 2           // longest pulse in T for the move: the 3T long pulses of the variants and their jitter
+#define KAKU_RX_LONGMAX 8
 
 #ifdef PLUGIN_003
 #include "../4_Display.h"
+#include "../9_Demod.h"
+
+const PulseRange Plugin_003_Pulses[] PROGMEM = {{KAKU_CodeLength * 4 + 2, KAKU_CodeLength * 4 + 2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_003_Desc[] PROGMEM = PLUGIN_DESC_003;
+
+// Bit layouts of the 12 bit code (bit 0 is sent first), see the variations above
+#define KAKU_ARC 0     // Kaku / Intertechno and compatibles
+#define KAKU_SARTANO 1 // AB400 / Sartano / Phenix
+#define KAKU_IMPULS 2  // Impuls
+#define KAKU_BLOKKER 3 // Blokker / SelectRemote, the only layout with 1 bits
+#define KAKU_ARC_FIXED 0x700 // bits 8-10 are always 110 in every layout but Sartano
+#define KAKU_ARC_110 0x600
+#define KAKU_SYMBOLS 0x555555UL // low bit of each symbol of the 24 bit packet identifier
+#define KAKU_FIRST 0x400000UL   // low bit of its first symbol
+#define KAKU_LAST 0x000001UL    // low bit of its last symbol
+
+struct KakuVariant // Shortest and longest pulse of a packet in 32 uSec units, the first pulse left out
+{
+   byte LowMin, LowMax;
+   byte HighMin, HighMax;
+   byte Layout;
+};
+
+// First match wins, a packet in no row is KAKU_ARC
+const KakuVariant Plugin_003_Variants[] PROGMEM = {
+    {7, 8, 30, 31, KAKU_SARTANO},   // ELRO AB400
+    {9, 10, 36, 37, KAKU_ARC},      // ELRO AB600
+    {9, 10, 40, 42, KAKU_ARC},      // ELRO AB600
+    {10, 11, 40, 42, KAKU_ARC},     // Profile PR44N / Promax RSL366T
+    {13, 13, 32, 34, KAKU_ARC},     // Profile PR47N
+    {11, 12, 31, 37, KAKU_SARTANO}, // Sartano
+    {12, 13, 45, 46, KAKU_SARTANO}, // Philips SBC
+    {0, 3, 22, 23, KAKU_IMPULS}};   // Philips SBC
+
+struct KakuLayout // A field is ((bitstream >> Shift) & Mask) ^ Xor
+{
+   uint16_t Zero; // bits that must be 0
+   byte HouseShift, HouseMask, HouseXor; // 'A' is added
+   byte UnitShift, UnitMask, UnitXor, UnitAdd;
+   byte CmdShift, CmdMask, CmdOn; // field value of an ON command
+};
+
+const KakuLayout Plugin_003_Layouts[] PROGMEM = {
+    {0x000, 0, 0x0F, 0x00, 4, 0x0F, 0x00, 1, 11, 0x01, 1},  // KAKU_ARC
+    {0x000, 0, 0x1F, 0x1F, 5, 0x1F, 0x00, 0, 10, 0x03, 2},  // KAKU_SARTANO, unit from Plugin_003_Buttons
+    {0x000, 0, 0x0F, 0x0F, 4, 0x1F, 0x1F, 0, 10, 0x03, 1},  // KAKU_IMPULS
+    {0xEF1, 1, 0x07, 0x07, 0, 0x00, 0x00, 0, 8, 0x01, 1}}; // KAKU_BLOKKER
 
-boolean Plugin_003(byte function, char *string)
+const byte Plugin_003_Buttons[] PROGMEM = {0x1E, 0x1D, 0x1B, 0x17, 0x0F}; // Sartano unit field of buttons 1..5
+
+boolean Plugin_003(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != (KAKU_CodeLength * 4) + 2)
+   if (Packet.Number != (KAKU_CodeLength * 4) + 2)
       return false; // conventionele KAKU bestaat altijd uit 12 data bits plus stop. Ongelijk, dan geen KAKU!
-   if (RawSignal.Pulses[0] == 15)
+   if (Packet.Hint == 15)
       return true; // Home Easy, skip KAKU
-   if (RawSignal.Pulses[0] == 63)
+   if (Packet.Hint == 63)
       return false; // No need to test, packet for plugin 63
-   if (RawSignal.Pulses[0] == 19)
+   if (Packet.Hint == 19)
       return false; // No need to test, packet for plugin 19
    // -------------------------------------------
    int i, j;
-   boolean error = false;
    unsigned long bitstream = 0L;  // to store a 12 bit code (ARC type)
    unsigned long bitstream2 = 0L; // to store a 24 bit code (Extended ARC type)
-   byte tricount = 0;
    // -------------------------------------------
    byte command = 0;   // ON/OFF/DIM/BRIGHT
    byte group = 0;     // flags group command
    byte housecode = 0; // 0x40 + 1 to 16?  (41-5a?)
    byte unitcode = 0;  // 1 to 16
    // -------------------------------------------
-   int PTLow = 22;      // Pulse Time - lowest found value (22 = a pulse duration of 550)
-   int PTHigh = 22;     // Pulse Time - highest found value
    byte signaltype = 0; // bit map:  bit 0 = 0   bit 1 = f   bit 2 = 0/1 (PT2262)
                         // meaning: byte value    3 = kaku (bit 0/f)  5=PT2262  7=tristate 0/1/f
-   byte devicetype = 0; // 0=Kaku   5=Impuls  7=Perel
+   byte Layout = KAKU_ARC;
    // -------------------------------------------
 
-   // -------------------------------------------
    // ==========================================================================
-   j = KAKU_PULSEMID; // set MID value
+   DemodSpan Span;
+   // set MID value, the first pulse left out as it is often affected by the start bit pulse duration
+   unsigned int T = Demod_Clock(Packet, 2, Packet.Number - 1, &Span);
+   j = Demod_ClockScale(KAKU_PULSEMID, KAKU_RX_T, T, Span, KAKU_RX_LONGMIN, KAKU_RX_LONGMAX);
    j--;
-   if (RawSignal.Pulses[0] == 33)
-   {                           // If device is "Impuls"
-      RawSignal.Pulses[0] = 0; // Unset Impuls conversion indicator
-      j = KAKU_R;              // Set new (LOWER!) MID value
-      devicetype = 5;          // Indicate Impuls device
+   if (Packet.Hint == 33)
+   {                        // If device is "Impuls"
+      j = KAKU_R;           // Set new (LOWER!) MID value
+      Layout = KAKU_IMPULS; // Indicate Impuls device
    }
    // -------------------------------------------
-   if (RawSignal.Pulses[49] > j)
+   if (Packet.Pulses[49] > j)
       return false; // Last pulse has to be low! Otherwise we are not dealing with an ARC signal
    // ==========================================================================
-   // TIMING MEASUREMENT, this will find the shortest and longest pulse within the RF packet
+   // TIMING MEASUREMENT, the shortest and longest pulse (from the walk of Demod_Clock()) pick a row of Plugin_003_Variants
    // ==========================================================================
-   for (i = 2; i < RawSignal.Number; i++) // skip first pulse as it is often affected by the start bit pulse duration
-   {
-      if (RawSignal.Pulses[i] < PTLow)       // shortest pulse?
-         PTLow = RawSignal.Pulses[i];        // new value
-      else if (RawSignal.Pulses[i] > PTHigh) // longest pulse?
-         PTHigh = RawSignal.Pulses[i];       // new value
-   }
-   // -------------------------------------------
-   // TIMING MEASUREMENT to devicetype
-   if (devicetype != 5)
+   if (Layout != KAKU_IMPULS)
    { // Dont do the timing check for Impuls, it is already identified at this point
-      if (((PTLow == 7) || (PTLow == 8)) && ((PTHigh == 30) || (PTHigh == 31)))
-         devicetype = 4; // ELRO AB400
-      if (((PTLow == 9) || (PTLow == 10)) && ((PTHigh == 36) || (PTHigh == 37) || ((PTHigh >= 40) && (PTHigh <= 42))))
-         devicetype = 1; // ELRO AB600
-      else if (((PTLow == 10) || (PTLow == 11)) && ((PTHigh >= 40) && (PTHigh <= 42)))
-         devicetype = 2; // Profile PR44N  / Promax rsl366t
-      else if ((PTLow == 13) && ((PTHigh >= 32) && (PTHigh <= 34)))
-         devicetype = 3; // Profile PR47N
-      else if (((PTLow >= 11) && (PTLow <= 12)) && ((PTHigh >= 31) && (PTHigh <= 37)))
-         devicetype = 4; // Sartano
-      else if (((PTLow == 12) || (PTLow == 13)) && ((PTHigh == 45) || (PTHigh == 46)))
-         devicetype = 4; // Philips SBC
-      else if ((PTLow <= 3) && ((PTHigh == 22) || (PTHigh == 23)))
-         devicetype = 5; // Philips SBC
-      //else
-      //if( (PTLow == 8 ||  PTLow == 9) && (PTHigh == 33 ||  PTHigh == 34) ) devicetype=7; // Perel st=0,dt=7
+      int PTLow = min(Span.Shortest / 32U, 22U); // Pulse Time - lowest found value, in 32 uSec units, 22 at most
+      int PTHigh = max(Span.Longest / 32U, 22U); // Pulse Time - highest found value, 22 at least
+
+      for (const KakuVariant *Variant = Plugin_003_Variants; Variant < Plugin_003_Variants + sizeof(Plugin_003_Variants) / sizeof(KakuVariant); Variant++)
+         if (PTLow >= pgm_read_byte(&Variant->LowMin) && PTLow <= pgm_read_byte(&Variant->LowMax) &&
+             PTHigh >= pgm_read_byte(&Variant->HighMin) && PTHigh <= pgm_read_byte(&Variant->HighMax))
+         {
+            Layout = pgm_read_byte(&Variant->Layout);
+            break;
+         }
    }
-   //sprintf(pbuffer, "ST=%d DT=%d %d/%d",signaltype,devicetype,PTLow,PTHigh);
-   //Serial.println( pbuffer );
    // ==========================================================================
-   // Turn pulses into bits
+   // Turn pulses into symbols: 0101 = 0, 0110 = f, 1010 = 1, 0100 = short 0. A pulse equal to MID is neither short nor long
    // -------------------------------------------
-   for (i = 0; i < KAKU_CodeLength; i++)
-   {
-      if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-      {                                  // 0101
-         bitstream = (bitstream >> 1);   // bit '0'
-         bitstream2 = (bitstream2 << 2); // bit '0' written as '00'
-         signaltype = signaltype | 1;    // bit '0' present in signal '0001'
-      }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
-      {              // 0110
-                     //!! untested !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-         tricount++; // tri-state bit counter
-         if ((i == 11) && (tricount == 1))
-         {                                                               // only the last bit, "on/off command" is in tristate mode? then it must be EMW200
-            bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
-            bitstream2 = (bitstream2 << 2) | 2;                          // bit 'f' written as '10'
-            // DONT CHANGE signal type to tri-state to keep EMW200 in KAKU mode
-         }
-         else
-         {
-            bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
-            bitstream2 = (bitstream2 << 2) | 2;                          // bit 'f' written as '10'
-            signaltype = signaltype | 2;                                 // bit 'f' present in signal '0010'
-         }
-      }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] < j)
-      {                                      // 0100
-         bitstream = (bitstream >> 1);       // Short 0, Group command on 2nd bit.  (NOT USED?!)
-         bitstream2 = (bitstream2 << 2) | 3; // bit 'short' written as '11'
-         group = 1;
-      }
-      else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
-      {                                      // 1010
-         bitstream2 = (bitstream2 << 2) | 1; // bit '1' written as '01'
-         signaltype = signaltype | 4;        // bit '1' present in signal '0100'
-         if (devicetype == 5)
-         {                                // in case of 'impuls remote' store
-            bitstream = (bitstream >> 1); // bit 1 (stored as 0) (IMPULS REMOTE)
-         }
-         else
-         {
-            if (i == 11)
-            {                                // last bit seems to cause trouble every now and then..?!
-               bitstream = (bitstream >> 1); // bit 1 (stored as 0) (IMPULS REMOTE)
-            }
-            else
-            {
-               devicetype = 6;
-               bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
-            }
-         }
-      }
-      else
-      {
-         // -------------------------------------------
-         // following are signal patches to fix bad transmission/receptions
-         // -------------------------------------------
-         if (i == 0)
-         {                                  // are we dealing with a RTK/AB600 device? then the first bit is sometimes mistakenly seen as 1101
-            bitstream2 = (bitstream2 << 2); // bit 0
-            if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-            {                                // 1101
-               bitstream = (bitstream >> 1); // 0, treat as 0101 eg 0 bit
-            }
-            else
-            {
-               error = true;
-               signaltype = signaltype | 8;
-            }
-         }
-         else
-         {
-            error = true;
-            signaltype = signaltype | 8;
-         }
-      } // bad signal
+   const DemodTiming Timing = {(RawPulse)j, 0, (RawPulse)(j - 1), 0, 0};
+   DemodBits Bits;
+   boolean Patched = false;
+
+   if (!Demod_Tristate(Packet, 1, KAKU_CodeLength, Timing, Bits))
+   { // are we dealing with a RTK/AB600 device? then the first bit is sometimes mistakenly seen as 1101
+      if (!(Packet.Pulses[1] > j && Packet.Pulses[2] > j && Packet.Pulses[3] < j && Packet.Pulses[4] > j))
+         return false; // a pattern other than 0101/0110, usually a semi-compatible device that has more states than ARC
+      Bits.Bytes[0] = 0; // treat as 0101 eg 0 bit
+      Bits.Count = 2;
+      Patched = true;
+      if (!Demod_Tristate(Packet, 5, KAKU_CodeLength - 1, Timing, Bits))
+         return false; // a pattern other than 0101/0110 further on
+   }
+
+   // Symbol n from the end is bits 2n + 1 (Upper) and 2n (Lower) of the packet identifier: 0 = 00, 1 = 01, f = 10, short 0 = 11
+   bitstream2 = ((unsigned long)Bits.Bytes[0] << 16) | ((unsigned int)Bits.Bytes[1] << 8) | Bits.Bytes[2]; // first symbol highest
+   unsigned long Upper = (bitstream2 >> 1) & KAKU_SYMBOLS, Lower = bitstream2 & KAKU_SYMBOLS;
+   unsigned long Zeros = ~(Upper | Lower) & KAKU_SYMBOLS, Ones = Lower & ~Upper, Fs = Upper & ~Lower;
+
+   if (Patched)
+      Zeros &= ~KAKU_FIRST; // the 0 of a patched first bit does not count
+   if (Zeros)
+      signaltype |= 1; // bit '0' present in signal '0001'
+   if (Fs & ~KAKU_LAST)
+      signaltype |= 2; // bit 'f' present in signal '0010'. Only the last bit, "on/off command", in tristate keeps EMW200 in KAKU mode
+   if (Ones)
+      signaltype |= 4; // bit '1' present in signal '0100'
+   if (Upper & Lower)
+      group = 1; // Short 0, Group command on 2nd bit.  (NOT USED?!)
+   if (Layout != KAKU_IMPULS && (Ones & ~KAKU_LAST))
+   { // an 'impuls remote' and the last bit (that causes trouble every now and then) store a 1 as 0
+      Layout = KAKU_BLOKKER;
+      Fs |= Ones & ~KAKU_LAST;
    }
+   for (i = 0; i < KAKU_CodeLength; i++, Fs >>= 2)
+      bitstream = (bitstream << 1) | (Fs & 1); // bit f (1), the last symbol first so that bit 0 is the first one
    //==================================================================================
-   // Sort out devices based on signal type and timing measurements
+   // Sort out devices based on signal type
    // -------------------------------------------
-   //sprintf(pbuffer, "ST=%d DT=%d [%d]",signaltype,devicetype, error);
-   //Serial.println( pbuffer );
-   //Serial.println(bitstream,BIN);
-   //Serial.println(bitstream2,BIN);
-   // -------------------------------------------
-   // END OF TIMING MEASUREMENTS
-   // ==========================================================================
-   if (error == true)
-   {                // Error means that a pattern other than 0101/0110 was found
-      return false; // This usually means we are dealing with a semi-compatible device
-   }                // that might have more states than used by ARC
    if ((signaltype != 0x03) && (signaltype != 0x05) && (signaltype != 0x07))
       return false;
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
    //if( (SignalHash!=SignalHashPrevious) || ((RepeatingTimer+500)<millis()) ) {
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2)))
+   if ((Output.Plugin != Output.Seen.Previous) || ((Output.Seen.Timer + 500) < millis()) || (((Output.Seen.Timer + 1000) > millis()) && (Output.CRC != bitstream2)))
    {
       // not seen the RF packet recently
       if (signaltype == 0x07)
       {
-         if (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2))
+         if (((Output.Seen.Timer + 1000) > millis()) && (Output.CRC != bitstream2))
          {
             return true; // skip tristate after normal arc
          }
       }
-      //Serial.print("KAKU PREV:");
-      //Serial.println(SignalHashPrevious);
-      if ((SignalHashPrevious == 14) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 14;
+      if (Output.After(14, 2000))
          return true; // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      }
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
+      if (Output.After(11, 2000))
          return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-      SignalCRC = bitstream2; // store RF packet identifier
+      Output.CRC = bitstream2; // store RF packet identifier
    }
    else
    {
@@ -430,168 +403,65 @@ boolean Plugin_003(byte function, char *string)
       return true;
    }
    //==================================================================================
-   // Determine signal type to sort out the various houdecode/unitcode/button bits and on/off command bits
+   // Fields of the layout to housecode/unitcode/button bits and on/off command bits
    //==================================================================================
    if (signaltype != 0x07)
    {
-      if ((bitstream & 0x700) != 0x600)
-      { // valid but not real KAKU
-         devicetype = 4;
-      }
-      // -------------------------------------------
-      if (devicetype == 4)
-      { // Sartano
-         // ----------------------------------      // Sartano
-         housecode = ((bitstream)&0x0000001FL);       // .......11111b
-         unitcode = (((bitstream)&0x000003E0L) >> 5); // ..1111100000b
-         housecode = ~housecode;                      // Sartano housecode is 5 bit ('A' - '`')
-         housecode &= 0x0000001FL;                    // Translate housecode so that all jumpers off = 'A' and all jumpers on = '`'
-         housecode += 0x41;
-         switch (unitcode)
-         {          // Translate unit code into button number 1 - 5
-         case 0x1E: // E=1110
-            unitcode = 1;
-            break;
-         case 0x1D: // D=1101
-            unitcode = 2;
-            break;
-         case 0x1B: // B=1011
-            unitcode = 3;
-            break;
-         case 0x17: // 7=0111
-            unitcode = 4;
-            break;
-         case 0x0F: // f=1111
-            unitcode = 5;
-            break;
-         default:
-            //Serial.print("Sartano:");
-            devicetype = 3; // invalid for Sartano, fall back
-            break;
-         }
-         if (devicetype == 4)
-         { // Sartano
-            if (((bitstream >> 10) & 0x03) == 2)
-            {
-               command = 1; // On
-            }
-            else if (((bitstream >> 10) & 0x03) == 1)
-            {
-               command = 0; // Off
-            }
-         }
-      }
-      else
-          // -------------------------------------------
-          if (devicetype == 5)
-      {                                               // IMPULS
-         housecode = ((bitstream)&0x0000000FL);       // ........1111b
-         unitcode = (((bitstream)&0x000003F0L) >> 4); // ..1111110000b
-         housecode = ~housecode;                      // Impuls housecode is 4 bit ('A' - 'P')
-         housecode &= 0x0000000FL;                    // Translate housecode so that all jumpers off = 'A' and all jumpers on = 'P'
-         housecode += 0x41;
-         unitcode = ~unitcode;    // Impuls unitcode is 5 bit
-         unitcode &= 0x0000001FL; // Translate unitcode so that all jumpers off = '1' and all jumpers on = '64'
-         if (((bitstream >> 10) & 0x03) == 2)
-         {
-            command = 0; // Off
-         }
-         else if (((bitstream >> 10) & 0x03) == 1)
-         {
-            command = 1; // On
-         }
-      }
-      else
-          // -------------------------------------------
-          if (devicetype == 6)
-      { // Blokker/SelectRemote
-         // ----------------------------------
-         if (((bitstream)&0xef1) != 0)
-            return false; // Not a valid bitstream
-
-         housecode = ((bitstream)&0x0000000EL); // Isolate housecode
-         housecode = housecode >> 1;            // shift right 1 bit
-         housecode = (~housecode) & 0x07;       // invert bits
-         housecode += 0x41;                     // add 'A'
-         unitcode = 0;
-
-         if (((bitstream >> 8) & 0x01) == 1)
-         {
-            command = 1; // On
-         }
-         else
-         {
-            command = 0; // Off
-         }
-         // ----------------------------------      // Sartano
-      }
-      else
-          // -------------------------------------------
-          if (devicetype != 4)
-      { // KAKU (and some compatibles for now)
-         // ----------------------------------
-         if ((bitstream & 0x700) != 0x600)
-         { // valid but not real KAKU
-            housecode = (((bitstream)&0x0f) + 0x41);
-            unitcode = ((((bitstream)&0xf0) >> 4) + 1);
-            devicetype = 1;
-         }
+      KakuLayout Fields;
+
+      if ((bitstream & KAKU_ARC_FIXED) != KAKU_ARC_110)
+         Layout = KAKU_SARTANO; // valid but not real KAKU
+      memcpy_P(&Fields, &Plugin_003_Layouts[Layout], sizeof(KakuLayout));
+      if (bitstream & Fields.Zero)
+         return false; // Not a valid bitstream
+      housecode = (((bitstream >> Fields.HouseShift) & Fields.HouseMask) ^ Fields.HouseXor) + 0x41;
+      unitcode = (((bitstream >> Fields.UnitShift) & Fields.UnitMask) ^ Fields.UnitXor) + Fields.UnitAdd;
+      command = (((bitstream >> Fields.CmdShift) & Fields.CmdMask) == Fields.CmdOn);
+      if (Layout == KAKU_SARTANO)
+      { // Translate unit code into button number 1 - 5
+         for (i = 0; i < (int)sizeof(Plugin_003_Buttons); i++)
+            if (unitcode == pgm_read_byte(Plugin_003_Buttons + i))
+               break;
+         if (i < (int)sizeof(Plugin_003_Buttons))
+            unitcode = i + 1;
          else
          {
-            if ((bitstream & 0x600) != 0x600)
-            {
-               //Serial.println("Kaku 0/1 error");
-               return false; // use two static bits as checksum
-            }
-            //bitstream=(bitstream)&0xffe;               // kill bit to ensure Perel works -> actually kills code wheel letter B
-            housecode = (((bitstream)&0x0f) + 0x41);
-            unitcode = ((((bitstream)&0xf0) >> 4) + 1);
-            // ----------------------------------
-         }
-         if (((bitstream >> 11) & 0x01) == 1)
-         {
-            command = 1; // ON
-         }
-         else
-         {
-            command = 0; // OFF
+            Layout = KAKU_ARC; // invalid for Sartano, fall back
+            command = 0;
          }
       }
    }
    // ==========================================================================
    // Output
    // ----------------------------------
-   display_Header();
+   Output.Header();
 
    // ----------------------------------
    if (signaltype == 0x03)
    { // '0011' bits indicate bits 0 and f are used in the signal
-      if (devicetype < 4)
-         display_Name(PSTR("Kaku")); // KAKU (and some compatibles for now) label
+      if (Layout == KAKU_ARC)
+         Output.Name(PSTR("Kaku")); // KAKU (and some compatibles for now) label
+      else if (Layout == KAKU_SARTANO)
+         Output.Name(PSTR("AB400D")); // AB440R and Sartano label
+      else if (Layout == KAKU_IMPULS)
+         Output.Name(PSTR("Impuls")); // Impuls label
       else
-      {
-         if (devicetype == 4)
-            display_Name(PSTR("AB400D")); // AB440R and Sartano label
-         else if (devicetype == 5)
-            display_Name(PSTR("Impuls")); // Impuls label
-         else
-            display_Name(PSTR("Sartano")); // Others
-      }
+         Output.Name(PSTR("Sartano")); // Others
    }
    else if (signaltype == 0x05)
    { // '0101' bits indicate bits 0 and 1 are used in the signal
-      if (devicetype == 5)
-         display_Name(PSTR("Impuls")); // Impuls label
+      if (Layout == KAKU_IMPULS)
+         Output.Name(PSTR("Impuls")); // Impuls label
       else
-         display_Name(PSTR("PT2262")); // Others
+         Output.Name(PSTR("PT2262")); // Others
    }
    else if (signaltype == 0x07)
-      display_Name(PSTR("TriState")); // '0111' bits indicate bits 0, f and 1 are used in the signal (tri-state)
+      Output.Name(PSTR("TriState")); // '0111' bits indicate bits 0, f and 1 are used in the signal (tri-state)
    // ----------------------------------
 
    if (signaltype == 0x07)
    {                                                  // '0111' bits indicate bits 0, f and 1 are used in the signal (tri-state)
-      display_IDn(((bitstream2 >> 4) & 0xFFFFFF), 6); // "%S%06lx
+      Output.IDn(((bitstream2 >> 4) & 0xFFFFFF), 6); // "%S%06lx
 
       housecode = (bitstream2 & 0x03);
       unitcode = ((((bitstream2 >> 2) & 0x03) ^ 0x03) ^ housecode);
@@ -602,15 +472,14 @@ boolean Plugin_003(byte function, char *string)
          command = 1; // 0 stays 0 (OFF), 1 and f become 1 (ON)
    }
    else
-      display_IDn(housecode, 2);
+      Output.IDn(housecode, 2);
 
-   display_SWITCH(unitcode);
-   display_CMD(group, command); // #ALL, #ON
-   display_Footer();
+   Output.SWITCH(unitcode);
+   Output.CMD(group, command); // #ALL, #ON
+   Output.Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_003
@@ -47,48 +47,61 @@
 #define PLUGIN_DESC_004 "NewKaku"
 #define NewKAKU_RawSignalLength 132            // regular KAKU packet length
 #define NewKAKUdim_RawSignalLength 148         // KAKU packet length including DIM bits
-#define NewKAKU_mT 650 / RAWSIGNAL_SAMPLE_RATE // us, approx. in between 1T and 4T
+#define NewKAKU_mT PULSE_US(650) // us, approx. in between 1T and 4T
+#define NewKAKU_T 175            // us, 1T of the samples above, NewKAKU_mT moves with the 1T of each packet
+#define NewKAKU_LONGMIN 5        // longest pulse in T of the first 4 bits for the move: the long pulse of a bit
+#define NewKAKU_LONGMAX 12
 
 #ifdef PLUGIN_004
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_004(byte function, char *string)
+const PulseRange Plugin_004_Pulses[] PROGMEM = {{NewKAKU_RawSignalLength, NewKAKU_RawSignalLength}, {NewKAKUdim_RawSignalLength, NewKAKUdim_RawSignalLength}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_004_Desc[] PROGMEM = PLUGIN_DESC_004;
+const PluginSignature Plugin_004_Signature PROGMEM = {50, 700, 2, 2, 0, 0}; // 1T start bit (a fast remote too), 8T latch right after it
+
+boolean Plugin_004(const PacketView &Packet, PluginOutput &Output)
 {
    // nieuwe KAKU bestaat altijd uit start bit + 32 bits + evt 4 dim bits. Ongelijk, dan geen NewKAKU
-   if ((RawSignal.Number != NewKAKU_RawSignalLength) && (RawSignal.Number != NewKAKUdim_RawSignalLength))
+   if ((Packet.Number != NewKAKU_RawSignalLength) && (Packet.Number != NewKAKUdim_RawSignalLength))
       return false;
-   if (RawSignal.Pulses[0] == 15)
+   if (Packet.Hint == 15)
       return true; // Home Easy, skip KAKU
    boolean Bit = 0;
    int i;
-   //int P0,P1,P2,P3;
-   byte P0, P1, P2, P3;
+   DemodSpan Span;
+   unsigned int T = Demod_Clock(Packet, 3, 18, &Span); // 1T of the first 4 bits
+   byte L = Packet.SymbolAbove(Demod_ClockScale(NewKAKU_mT, NewKAKU_T, T, Span, NewKAKU_LONGMIN, NewKAKU_LONGMAX)); // first long (4T) symbol
+   boolean P0, P1, P2, P3;           // pulse is long
    byte dim = 0;
    byte dimbitpresent = 0;
    unsigned long bitstream = 0L;
 
-   // RawSignal.Pulses[1] startbit with duration of 1T => ignore
-   // RawSignal.Pulses[2] long space after startbit with duration of 8T => ignore
-   i = 3; // RawSignal.Pulses[3] is first pulse of a T,xT,T,xT combination
+   if (L == 0 || L >= Packet.Clusters)
+      return false; // needs both short and long pulses
+
+   // Packet.Pulses[1] startbit with duration of 1T => ignore
+   // Packet.Pulses[2] long space after startbit with duration of 8T => ignore
+   i = 3; // Packet.Pulses[3] is first pulse of a T,xT,T,xT combination
    do
    {
-      P0 = RawSignal.Pulses[i];     // * RawSignal.Multiply;
-      P1 = RawSignal.Pulses[i + 1]; // * RawSignal.Multiply;
-      P2 = RawSignal.Pulses[i + 2]; // * RawSignal.Multiply;
-      P3 = RawSignal.Pulses[i + 3]; // * RawSignal.Multiply;
+      P0 = Packet.Symbol(i) >= L;
+      P1 = Packet.Symbol(i + 1) >= L;
+      P2 = Packet.Symbol(i + 2) >= L;
+      P3 = Packet.Symbol(i + 3) >= L;
 
-      if (P0 < NewKAKU_mT && P1 < NewKAKU_mT && P2 < NewKAKU_mT && P3 > NewKAKU_mT)
+      if (!P0 && !P1 && !P2 && P3)
       {
          Bit = 0; // T,T,T,4T
       }
-      else if (P0 < NewKAKU_mT && P1 > NewKAKU_mT && P2 < NewKAKU_mT && P3 < NewKAKU_mT)
+      else if (!P0 && P1 && !P2 && !P3)
       {
          Bit = 1; // T,4T,T,T
       }
-      else if (P0 < NewKAKU_mT && P1 < NewKAKU_mT && P2 < NewKAKU_mT && P3 < NewKAKU_mT)
+      else if (!P0 && !P1 && !P2 && !P3)
       { // T,T,T,T should be on i=111 (bit 28)
          dimbitpresent = 1;
-         if (RawSignal.Number != NewKAKUdim_RawSignalLength)
+         if (Packet.Number != NewKAKUdim_RawSignalLength)
          { // dim set but no dim bits present => invalid signal
             return false;
          }
@@ -107,45 +120,33 @@ boolean Plugin_004(byte function, char *string)
          dim = (dim << 1) | Bit;
       }
       i += 4;                          // Next 4 pulses
-   } while (i < RawSignal.Number - 2); //-2 to exclude the stopbit space/pulse
+   } while (i < Packet.Number - 2); //-2 to exclude the stopbit space/pulse
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 700) < millis()) || (SignalCRC != bitstream))
-   { // 1000
-      // not seen the RF packet recently
-      //if ((SignalHashPrevious==14) && ((RepeatingTimer+2000)>millis()) ) {
-      //   SignalHash=14;
-      //   return true;                            // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      //}
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-
-      SignalCRC = bitstream;
-   }
-   else
+   if (Output.Repeat(bitstream, 700)) // 1000
       return true; // already seen the RF packet recently
+   //if (Output.After(14, 2000))
+   //   return true; // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (Output.After(11, 2000))
+      return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
    //==================================================================================
    // Output
    //==================================================================================
-   display_Header();
-   display_Name(PSTR("NewKaku"));
-   display_IDn(((bitstream >> 6) & 0xFFFFFFFF), 8); //"%S%08lx"
+   Output.Header();
+   Output.Name(PSTR("NewKaku"));
+   Output.IDn(((bitstream >> 6) & 0xFFFFFFFF), 8); //"%S%08lx"
    char c_SWITCH[5];
    sprintf(c_SWITCH, "%1x", ((byte)(bitstream & 0x0f) + 1)); // No leading 0
-   display_SWITCHc(c_SWITCH);
+   Output.SWITCHc(c_SWITCH);
 
    if (i > 140 && dimbitpresent == 1)
-      display_SET_LEVEL(dim); // Command and Dim part
+      Output.SET_LEVEL(dim); // Command and Dim part
    else
-      display_CMD((CMD_Group)((bitstream >> 5) & B01), (CMD_OnOff)((bitstream >> 4) & B01)); // #ALL , #ON
-   display_Footer();
+      Output.CMD((CMD_Group)((bitstream >> 5) & B01), (CMD_OnOff)((bitstream >> 4) & B01)); // #ALL , #ON
+   Output.Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_004
@@ -42,19 +42,26 @@
 #define PLUGIN_DESC_005 "Eurodomest"
 #define EURODOMEST_PulseLength 50
 
-#define EURODOMEST_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
-#define EURODOMEST_PULSEMIN 100 / RAWSIGNAL_SAMPLE_RATE
-#define EURODOMEST_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
+#define EURODOMEST_PULSEMID PULSE_US(400)
+#define EURODOMEST_PULSEMIN PULSE_US(100)
+#define EURODOMEST_PULSEMAX PULSE_US(900)
 
 #ifdef PLUGIN_005
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_005(byte function, char *string)
+const PulseRange Plugin_005_Pulses[] PROGMEM = {{EURODOMEST_PulseLength, EURODOMEST_PulseLength}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_005_Desc[] PROGMEM = PLUGIN_DESC_005;
+const DemodTiming Plugin_005_Timing = {EURODOMEST_PULSEMID, EURODOMEST_PULSEMIN, 0, EURODOMEST_PULSEMAX, 0};
+
+boolean Plugin_005(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != EURODOMEST_PulseLength)
+   if (Packet.Number != EURODOMEST_PulseLength)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (Packet.Hint == 63)
       return false; // No need to test, packet for plugin 63
+   if (Packet.Pulses[EURODOMEST_PulseLength] > PULSE_US(4000) && Packet.Pulses[EURODOMEST_PulseLength] < PULSE_US(5000))
+      return false; // No need to test, 48 pulses, a closing pulse and a 4-5 mSec gap are for plugin 65
 
    unsigned long bitstream = 0;
    byte unitcode = 0;
@@ -63,31 +70,13 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[49] > EURODOMEST_PULSEMID)
+   if (Packet.Pulses[49] > EURODOMEST_PULSEMID)
       return false; // last pulse needs to be short, otherwise no Eurodomest protocol
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (int x = 2; x < EURODOMEST_PulseLength; x += 2)
-   {
-      bitstream <<= 1; //Always shift
-      if (RawSignal.Pulses[x] > EURODOMEST_PULSEMID)
-      { // long pulse
-         if (RawSignal.Pulses[x - 1] > EURODOMEST_PULSEMID)
-            return false; // not a 01 or 10 transmission
-         if (RawSignal.Pulses[x] > EURODOMEST_PULSEMAX)
-            return false; // make sure the long pulse is within range
-         bitstream |= 0x1;
-      }
-      else
-      { // short pulse
-         if (RawSignal.Pulses[x] < EURODOMEST_PULSEMIN)
-            return false; // pulse too short to be Eurodomest
-         if (RawSignal.Pulses[x - 1] < EURODOMEST_PULSEMID)
-            return false; // not a 01 or 10 transmission
-         // bitstream |= 0x0;
-      }
-   }
+   if (!Demod_PWM(Packet, 1, 24, Plugin_005_Timing, DEMOD_SECOND, bitstream))
+      return false; // not a 01 or 10 transmission, or a pulse out of range
 
    //==================================================================================
    // Perform a quick sanity check
@@ -97,9 +86,7 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Output.Repeat(bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform more sanity checks to prevent false positives
@@ -124,19 +111,18 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Output
    // ----------------------------------
-   display_Header();
-   display_Name(PSTR("Eurodomest"));
-   display_IDn(address, 6);  //"%S%06lx"
-   display_SWITCH(unitcode); // %02x
+   Output.Header();
+   Output.Name(PSTR("Eurodomest"));
+   Output.IDn(address, 6);  //"%S%06lx"
+   Output.SWITCH(unitcode); // %02x
    if (unitcode > 4)
-      display_CMD(CMD_All, (command != 0x0)); // #ALL #ON 
+      Output.CMD(CMD_All, (command != 0x0)); // #ALL #ON 
    else
-      display_CMD(CMD_Single, (command != 0X1)); // #ALL #ON
-   display_Footer();
+      Output.CMD(CMD_Single, (command != 0X1)); // #ALL #ON
+   Output.Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_005
@@ -38,11 +38,14 @@
 #define BLYSS_PLUGIN_ID 006
 #define PLUGIN_DESC_006 "Blyss / Avidsen"
 #define BLYSS_PULSECOUNT 106
-#define BLYSS_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
+#define BLYSS_PULSEMID PULSE_US(500)
 
 #ifdef PLUGIN_006
 #include "../4_Display.h"
 
+const PulseRange Plugin_006_Pulses[] PROGMEM = {{BLYSS_PULSECOUNT, BLYSS_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_006_Desc[] PROGMEM = PLUGIN_DESC_006;
+
 boolean Plugin_006(byte function, char *string)
 {
    if (RawSignal.Number != BLYSS_PULSECOUNT)
@@ -46,11 +46,14 @@
 #define PLUGIN_DESC_007 "Conrad"
 #define CONRADRSL2_PULSECOUNT 66
 
-#define CONRADRSL2_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
+#define CONRADRSL2_PULSEMID PULSE_US(600)
 
 #ifdef PLUGIN_007
 #include "../4_Display.h"
 
+const PulseRange Plugin_007_Pulses[] PROGMEM = {{CONRADRSL2_PULSECOUNT, CONRADRSL2_PULSECOUNT + 2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_007_Desc[] PROGMEM = PLUGIN_DESC_007;
+
 boolean Plugin_007(byte function, char *string)
 {
    if ((RawSignal.Number != CONRADRSL2_PULSECOUNT) && (RawSignal.Number != CONRADRSL2_PULSECOUNT + 2))
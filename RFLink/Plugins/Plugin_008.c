@@ -35,11 +35,14 @@
 #define PLUGIN_DESC_008 "Kambrook"
 #define KAMBROOK_PULSECOUNT 96
 
-#define KAMBROOK_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
+#define KAMBROOK_PULSEMID PULSE_US(400)
 
 #ifdef PLUGIN_008
 #include "../4_Display.h"
 
+const PulseRange Plugin_008_Pulses[] PROGMEM = {{KAMBROOK_PULSECOUNT, KAMBROOK_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_008_Desc[] PROGMEM = PLUGIN_DESC_008;
+
 boolean Plugin_008(byte function, char *string)
 {
     if (RawSignal.Number != KAMBROOK_PULSECOUNT)
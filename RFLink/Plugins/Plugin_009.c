@@ -47,11 +47,14 @@
 #define PLUGIN_DESC_009 "X10"
 #define X10_PulseLength 66
 
-#define X10_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
+#define X10_PULSEMID PULSE_US(600)
 
 #ifdef PLUGIN_009
 #include "../4_Display.h"
 
+const PulseRange Plugin_009_Pulses[] PROGMEM = {{X10_PulseLength, X10_PulseLength + 2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_009_Desc[] PROGMEM = PLUGIN_DESC_009;
+
 boolean Plugin_009(byte function, char *string)
 {
    if ((RawSignal.Number != (X10_PulseLength)) && (RawSignal.Number != (X10_PulseLength + 2)))
@@ -67,7 +70,7 @@ boolean Plugin_009(byte function, char *string)
    //==================================================================================
    if (RawSignal.Number == X10_PulseLength + 2)
    {
-      if ((RawSignal.Pulses[1] * RawSignal.Multiply > 3000) && (RawSignal.Pulses[2] * RawSignal.Multiply > 3000))
+      if ((PULSE_TO_US(RawSignal.Pulses[1]) > 3000) && (PULSE_TO_US(RawSignal.Pulses[2]) > 3000))
          start = 2;
       else
          return false; // not an X10 packet
@@ -50,16 +50,19 @@
 #define RGB_MIN_PULSECOUNT 180
 #define RGB_MAX_PULSECOUNT 186
 
-#define RGB_PULSE_STHI 1600 / RAWSIGNAL_SAMPLE_RATE
-#define RGB_PULSE_STLO 1300 / RAWSIGNAL_SAMPLE_RATE
-#define RGB_PULSE_HIHI 1100 / RAWSIGNAL_SAMPLE_RATE
-#define RGB_PULSE_HILO 900 / RAWSIGNAL_SAMPLE_RATE
-#define RGB_PULSE_LOHI 600 / RAWSIGNAL_SAMPLE_RATE
-#define RGB_PULSE_LOLO 400 / RAWSIGNAL_SAMPLE_RATE
+#define RGB_PULSE_STHI PULSE_US(1600)
+#define RGB_PULSE_STLO PULSE_US(1300)
+#define RGB_PULSE_HIHI PULSE_US(1100)
+#define RGB_PULSE_HILO PULSE_US(900)
+#define RGB_PULSE_LOHI PULSE_US(600)
+#define RGB_PULSE_LOLO PULSE_US(400)
 
 #ifdef PLUGIN_010
 #include "../4_Display.h"
 
+const PulseRange Plugin_010_Pulses[] PROGMEM = {{RGB_MIN_PULSECOUNT, RGB_MAX_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_010_Desc[] PROGMEM = PLUGIN_DESC_010;
+
 boolean Plugin_010(byte function, char *string)
 {
    if (RawSignal.Number < RGB_MIN_PULSECOUNT || RawSignal.Number > RGB_MAX_PULSECOUNT)
@@ -94,7 +97,7 @@ boolean Plugin_010(byte function, char *string)
             continue;
          }
       }
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 750 && RawSignal.Pulses[x] * RawSignal.Multiply < 1000)
+      if (PULSE_TO_US(RawSignal.Pulses[x]) > 750 && PULSE_TO_US(RawSignal.Pulses[x]) < 1000)
       {
          if (halfbit == 1) // cant receive a 1 bit after a single low value
             return false;  // pulse error, must not be a UPM packet or reception error
@@ -118,7 +121,7 @@ boolean Plugin_010(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 625 && RawSignal.Pulses[x] * RawSignal.Multiply < 250)
+         if (PULSE_TO_US(RawSignal.Pulses[x]) > 625 && PULSE_TO_US(RawSignal.Pulses[x]) < 250)
             return false; // Not a valid UPM pulse length
 
          if (halfbit == 0) // 2 times a low value = 0 bit
@@ -146,7 +149,7 @@ boolean Plugin_010(byte function, char *string)
    }
    //==================================================================================
    // Validity checks
-   if (RawSignal.Pulses[x + 2] * RawSignal.Multiply < 1200 || RawSignal.Pulses[x + 2] * RawSignal.Multiply > 1500)
+   if (PULSE_TO_US(RawSignal.Pulses[x + 2]) < 1200 || PULSE_TO_US(RawSignal.Pulses[x + 2]) > 1500)
       return false;
    //==================================================================================
    // perform a checksum check to make sure the packet is a valid RGB control packet
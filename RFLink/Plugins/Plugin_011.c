@@ -81,19 +81,28 @@
 #define HC_PLUGIN_ID 011
 #define PLUGIN_DESC_011 "HomeConfort"
 #define HC_PULSECOUNT 100
-#define HC_PULSE_PREAMBLE 2400 / RAWSIGNAL_SAMPLE_RATE
-#define HC_PULSE_MID       500 / RAWSIGNAL_SAMPLE_RATE
-#define HC_PULSE_MAX       800 / RAWSIGNAL_SAMPLE_RATE
+#define HC_PULSE_PREAMBLE PULSE_US(2400)
+#define HC_PULSE_MID       PULSE_US(500)
+#define HC_PULSE_MAX       PULSE_US(800)
 
 #ifdef PLUGIN_011
 #include "../4_Display.h"
 
-boolean Plugin_011(byte function, char *string)
+const PulseRange Plugin_011_Pulses[] PROGMEM = {{HC_PULSECOUNT - 1, HC_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted, a frame has no preamble
+const char Plugin_011_Desc[] PROGMEM = PLUGIN_DESC_011;
+
+boolean Plugin_011(const PacketView &Packet, PluginOutput &Output)
 {
-  if (RawSignal.Number != HC_PULSECOUNT) // Incorrect pulse count
-      return false;
-  if (RawSignal.Pulses[1] < HC_PULSE_PREAMBLE )
-      return false; // First (start) pulse needs to be long
+  int first = 2; // first data pulse
+  if (Packet.Number == HC_PULSECOUNT)
+  {
+     if (Packet.Pulses[1] < HC_PULSE_PREAMBLE)
+        return false; // First (start) pulse needs to be long
+  }
+  else if (Packet.Number == HC_PULSECOUNT - 1 && Packet.Offset > 0 && Packet.Pulses[0] >= HC_PULSE_PREAMBLE)
+     first = 1; // Frame from the splitter, the preamble closed the sync before Pulses[1]
+  else
+     return false;
 
    unsigned long bitstream1 = 0; // holds first 24 bits
    unsigned long bitstream2 = 0; // holds last 26 bits
@@ -106,13 +115,13 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    // Get all 48 bits
    //==================================================================================
-   for (int x = 2; x < 96 ; x += 2) // Go through pulses
+   for (int x = first; x < first + 94; x += 2) // Go through pulses
    { // get bytes
-      if (RawSignal.Pulses[x] > HC_PULSE_MID )
+      if (Packet.Pulses[x] > HC_PULSE_MID )
       { // long pulse
-         if (RawSignal.Pulses[x] > HC_PULSE_MAX )
+         if (Packet.Pulses[x] > HC_PULSE_MAX )
             return false; // Pulse range check
-         if (RawSignal.Pulses[x + 1] > HC_PULSE_MID )
+         if (Packet.Pulses[x + 1] > HC_PULSE_MID )
             return false; // Manchester check
          if (bitcounter < 24)
          {
@@ -127,9 +136,9 @@ boolean Plugin_011(byte function, char *string)
       }
       else
       { // short pulse
-         if (RawSignal.Pulses[x] > HC_PULSE_MID)
+         if (Packet.Pulses[x] > HC_PULSE_MID)
             return false; // pulse range check
-         if (RawSignal.Pulses[x + 1] < HC_PULSE_MID )
+         if (Packet.Pulses[x + 1] < HC_PULSE_MID )
             return false; // Manchester check
          if (bitcounter < 24)
             bitstream1 <<= 1;
@@ -144,9 +153,7 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || ((RepeatingTimer + 500) < millis()) || SignalCRC != bitstream2)
-      SignalCRC = bitstream2; // not seen the RF packet recently
-   else
+   if (Output.Repeat(bitstream2, 500))
       return true; // already seen the RF packet recently
 
    //==================================================================================
@@ -161,21 +168,21 @@ boolean Plugin_011(byte function, char *string)
          int tempdecs = bitstream2 >> 7 & 0xF;
          int temperature = tempunits * 10 + tempdecs;
 
-         display_Header();
-         display_Name(PSTR("HomeConfort"));
-         display_IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
-         display_TEMP(temperature);
-         display_Footer();
+         Output.Header();
+         Output.Name(PSTR("HomeConfort"));
+         Output.IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
+         Output.TEMP(temperature);
+         Output.Footer();
       }
    else if ( (bitstream2 & 0x7F) == 0x42 )  
       { // Humidity
          byte hygro = bitstream2 >>15;
 
-         display_Header();
-         display_Name(PSTR("HomeConfort"));
-         display_IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
-         display_HUM(hygro, HUM_HEX);
-         display_Footer();
+         Output.Header();
+         Output.Name(PSTR("HomeConfort"));
+         Output.IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
+         Output.HUM(hygro, HUM_HEX);
+         Output.Footer();
       }
    else if ( (bitstream2 & 0xFFFFBF) == 0x0 ) 
       {  // Switch code - Taken from Original RFLink R29 code
@@ -198,21 +205,20 @@ boolean Plugin_011(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_Header();
-         display_Name(PSTR("HomeConfort"));
-         display_IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
+         Output.Header();
+         Output.Name(PSTR("HomeConfort"));
+         Output.IDn((bitstream1 & 0xFFFFFF), 6); //"%S%06lx"
          char c_SWITCH[5];
          sprintf(c_SWITCH, "%c%d", channel, subchan);
-         display_SWITCHc(c_SWITCH);
-         display_CMD((group & B01), (command & B01)); // #ALL , #ON
-         display_Footer();
+         Output.SWITCHc(c_SWITCH);
+         Output.CMD((group & B01), (command & B01)); // #ALL , #ON
+         Output.Footer();
          //==================================================================================
       }
    else // Unknow protocol or function
       return false;
        
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_011
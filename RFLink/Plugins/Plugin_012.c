@@ -26,6 +26,8 @@
  * It appears that the FA500S is only capable to react to the first method. So this has to be used to switch sockets
  * Nodo can only distinguish the 3rd method properly. Method 1 and 2 have to be pulled apart first which
  * is done via plugin 001.
+ * With the frame gap split of the capture (SIGNAL_SEGMENT_GAP_US) every frame of a burst is a packet of its own.
+ * Method 1 carries no on/off bit: its code is kept until the method 2 frame after it gives the state bit.
  *
  * Device types:
  * Elro FA500S Flamingo Switch 
@@ -80,18 +82,30 @@
 #define PLUGIN_DESC_012 "FA500"
 #define FA500RM3_PulseLength 26
 #define FA500RM1_PulseLength 58
+#define FA500RM1_SyncLength 60  // method 1 frame that still starts with its sync pulse and space, the first one of a split burst
+#define FA500RM2_PulseLength 130 // method 2 frame cut from a burst at its latch: 32 bits, stop pulse and gap
+#define FA500_BURST_MS 500       // the method 2 frames follow the method 1 frames of the same key press within this time
 
-#define FA500_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
+#define FA500_PULSEMID PULSE_US(400)
+#define FA500_SYNC PULSE_US(4000)
 
 #ifdef PLUGIN_012
 #include "../4_Display.h"
 
+const PulseRange Plugin_012_Pulses[] PROGMEM = {{FA500RM3_PulseLength, FA500RM3_PulseLength}, {FA500RM1_PulseLength, FA500RM1_PulseLength}, {FA500RM1_SyncLength, FA500RM1_SyncLength}, {FA500RM2_PulseLength, FA500RM2_PulseLength}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_012_Desc[] PROGMEM = PLUGIN_DESC_012;
+
+// Method 1 code waiting for the command of the method 2 frames of its burst
+static unsigned long Plugin_012_Code = 0L;
+static unsigned long Plugin_012_Time = 0L;
+
 boolean Plugin_012(byte function, char *string)
 {
-   if (RawSignal.Number != (FA500RM3_PulseLength) && RawSignal.Number != (FA500RM1_PulseLength))
+   if (RawSignal.Number != (FA500RM3_PulseLength) && RawSignal.Number != (FA500RM1_PulseLength) &&
+       RawSignal.Number != (FA500RM1_SyncLength) && RawSignal.Number != (FA500RM2_PulseLength))
       return false;
 
-   byte type = 0; // 0=KAKU 1=ITK 2=PT2262
+   byte type = 0; // 0=KAKU 1=ITK 2=PT2262 (method 2 after a method 1 code)
    byte housecode = 0;
    byte unitcode = 0;
    byte command = 0;
@@ -113,11 +127,38 @@ boolean Plugin_012(byte function, char *string)
          //    bitstream |= 0x0;
       }
    }
+   else if (RawSignal.Number == (FA500RM2_PulseLength))
+   {
+      // Method 2 is AC (NewKaku) compatible, its state bit is the command of the method 1 code before it
+      if (Plugin_012_Code == 0 || RawSignal.Time - Plugin_012_Time > FA500_BURST_MS)
+         return false;
+      unsigned long ac_bits = 0L;
+      for (byte x = 1; x <= FA500RM2_PulseLength - 2; x += 4)
+      {  // 0 = T,T,T,4T  1 = T,4T,T,T
+         if (RawSignal.Pulses[x] > FA500_PULSEMID || RawSignal.Pulses[x + 2] > FA500_PULSEMID)
+            return false;
+         boolean bit = (RawSignal.Pulses[x + 1] > FA500_PULSEMID);
+         if (bit == (RawSignal.Pulses[x + 3] > FA500_PULSEMID))
+            return false;
+         ac_bits = (ac_bits << 1) | bit;
+      }
+      type = 2;
+      command = (ac_bits >> 4) & 1; // 26 address bits, group, state, 4 unit bits
+      bitstream = Plugin_012_Code;
+      Plugin_012_Code = 0L;
+   }
    else
    {
       // get all 58pulses =>28 bits
+      byte first = 1;
+      if (RawSignal.Number == (FA500RM1_SyncLength))
+      { // first frame of a burst, skip the sync
+         if (RawSignal.Pulses[2] < FA500_SYNC)
+            return false;
+         first = 3;
+      }
       type = 1;
-      for (byte x = 1; x <= FA500RM1_PulseLength - 2; x += 2)
+      for (byte x = first; x <= first + FA500RM1_PulseLength - 3; x += 2)
       {                   // method 1
          bitstream <<= 1; // Always shift
          if (RawSignal.Pulses[x] > FA500_PULSEMID)
@@ -173,21 +214,29 @@ boolean Plugin_012(byte function, char *string)
       {
          return false;
       }
-      command = 2; // initialize to "unknown"
-      // Trick: here we use the on/off command from the other packet type as it is not detected in the current packet, it was passed via Pluses[0] in plugin 1
-      if (RawSignal.Pulses[0] * RawSignal.Multiply > 1000 && RawSignal.Pulses[0] * RawSignal.Multiply < 1400)
-      {
-         command = 0;
-      }
-      else if (RawSignal.Pulses[0] * RawSignal.Multiply > 100 && RawSignal.Pulses[0] * RawSignal.Multiply < 400)
+      if (type == 1)
       {
-         command = 1;
+         command = 2; // initialize to "unknown"
+         // Trick: here we use the on/off command from the other packet type as it is not detected in the current packet, it was passed via Pluses[0] in plugin 1
+         if (PULSE_TO_US(RawSignal.Pulses[0]) > 1000 && PULSE_TO_US(RawSignal.Pulses[0]) < 1400)
+         {
+            command = 0;
+         }
+         else if (PULSE_TO_US(RawSignal.Pulses[0]) > 100 && PULSE_TO_US(RawSignal.Pulses[0]) < 400)
+         {
+            command = 1;
+         }
       }
       address = bitstream;
    }
    if (command > 1)
    {
       //Serial.println("FA500R error3");
+      if (type == 1)
+      { // The method 2 frames of the burst will tell
+         Plugin_012_Code = bitstream;
+         Plugin_012_Time = RawSignal.Time;
+      }
       return false;
    }
    if (housecode != 0x01 && housecode != 0x04 && housecode != 0x05 && housecode != 0x00)
@@ -92,13 +92,17 @@
 #define PLUGIN_DESC_013 "Powerfix"
 #define POWERFIX_PulseLength 42
 
-#define POWEFIX_PULSEMID 900 / RAWSIGNAL_SAMPLE_RATE
-#define POWEFIX_PULSEMIN 450 / RAWSIGNAL_SAMPLE_RATE
-#define POWEFIX_PULSEMAX 1400 / RAWSIGNAL_SAMPLE_RATE
+#define POWEFIX_PULSEMID PULSE_US(900)
+#define POWEFIX_PULSEMIN PULSE_US(450)
+#define POWEFIX_PULSEMAX PULSE_US(1400)
 
 #ifdef PLUGIN_013
 #include "../4_Display.h"
 
+const PulseRange Plugin_013_Pulses[] PROGMEM = {{POWERFIX_PulseLength, POWERFIX_PulseLength}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_013_Desc[] PROGMEM = PLUGIN_DESC_013;
+const PluginSignature Plugin_013_Signature PROGMEM = {0, 950, 0, 0, 0, 0}; // short start pulse, see POWEFIX_PULSEMID
+
 boolean Plugin_013(byte function, char *string)
 {
    if (RawSignal.Number != POWERFIX_PulseLength)
@@ -38,13 +38,17 @@
 #define KOPPLA_PulseLength_MIN 36
 #define KOPPLA_PulseLength_MAX 52
 
-#define KOPPLA_PULSEMID 1300 / RAWSIGNAL_SAMPLE_RATE
-#define KOPPLA_PULSEMAX 1850 / RAWSIGNAL_SAMPLE_RATE
-#define KOPPLA_PULSEMIN 650 / RAWSIGNAL_SAMPLE_RATE
+#define KOPPLA_PULSEMID PULSE_US(1300)
+#define KOPPLA_PULSEMAX PULSE_US(1850)
+#define KOPPLA_PULSEMIN PULSE_US(650)
 
 #ifdef PLUGIN_014
 #include "../4_Display.h"
 
+const PulseRange Plugin_014_Pulses[] PROGMEM = {{KOPPLA_PulseLength_MIN, KOPPLA_PulseLength_MAX}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_014_Desc[] PROGMEM = PLUGIN_DESC_014;
+const PluginSignature Plugin_014_Signature PROGMEM = {600, 2000, 0, 0, 0, 0}; // every pulse 650..1850 uSec, see KOPPLA_PULSEMIN/MAX
+
 boolean Plugin_014(byte function, char *string)
 {
    if ((RawSignal.Number < KOPPLA_PulseLength_MIN) || (RawSignal.Number > KOPPLA_PulseLength_MAX))
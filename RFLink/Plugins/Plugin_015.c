@@ -51,10 +51,17 @@
 #define PLUGIN_DESC_015 "HomeEasy"
 #define HomeEasy_PulseLength 116
 
-#define HomeEasy_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
+#define HomeEasy_PULSEMID PULSE_US(500)
+#define HomeEasy_T 150 // us, 1T that HomeEasy_PULSEMID is set for, it moves with the 1T of the preamble
+#define HomeEasy_LONGMIN 5 // longest pulse of the preamble in T for the move: the long pulse of a bit
+#define HomeEasy_LONGMAX 12
 
 #ifdef PLUGIN_015
 #include "../4_Display.h"
+#include "../9_Demod.h"
+
+const PulseRange Plugin_015_Pulses[] PROGMEM = {{HomeEasy_PulseLength, HomeEasy_PulseLength}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_015_Desc[] PROGMEM = PLUGIN_DESC_015;
 
 boolean Plugin_015(byte function, char *string)
 {
@@ -70,6 +77,10 @@ boolean Plugin_015(byte function, char *string)
    byte type = 0;
    byte temp = 0;
    RawSignal.Pulses[0] = 0; // undo any Home Easy to Kaku blocking that might be active
+   const PacketView Packet(RawSignal);
+   DemodSpan Span;
+   unsigned int T = Demod_Clock(Packet, 1, 22, &Span); // 11 bits preamble
+   RawPulse mid = Demod_ClockScale(HomeEasy_PULSEMID, HomeEasy_T, T, Span, HomeEasy_LONGMIN, HomeEasy_LONGMAX);
    //==================================================================================
    // Get all 58? bits
    //==================================================================================
@@ -78,7 +89,7 @@ boolean Plugin_015(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x <= HomeEasy_PulseLength; x = x + 2)
    {
-      if ((RawSignal.Pulses[x] < HomeEasy_PULSEMID) && (RawSignal.Pulses[x + 1] > HomeEasy_PULSEMID))
+      if ((RawSignal.Pulses[x] < mid) && (RawSignal.Pulses[x + 1] > mid))
          rfbit = 1;
       else
          rfbit = 0;
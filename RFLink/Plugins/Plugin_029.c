@@ -57,11 +57,14 @@
 #define DKW2012_MIN_PULSECOUNT 170
 #define DKW2012_MAX_PULSECOUNT 178
 
-#define DKW2012_PULSEMINMAX 768 / RAWSIGNAL_SAMPLE_RATE
+#define DKW2012_PULSEMINMAX PULSE_US(768)
 
 #ifdef PLUGIN_029
 #include "../4_Display.h"
 
+const PulseRange Plugin_029_Pulses[] PROGMEM = {{ACH2010_MIN_PULSECOUNT, ACH2010_MAX_PULSECOUNT}, {DKW2012_MIN_PULSECOUNT, DKW2012_MAX_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_029_Desc[] PROGMEM = PLUGIN_DESC_029;
+
 uint8_t Plugin_029_ProtocolAlectoCRC8(uint8_t *addr, uint8_t len);
 
 boolean Plugin_029(byte function, char *string)
@@ -96,15 +96,18 @@
 #define PLUGIN_DESC_030 "Alecto V1"
 #define ALECTOV1_PULSECOUNT 74
 
-#define ALECTOV1_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
-#define ALECTOV1_PULSEMAXMIN 2560 / RAWSIGNAL_SAMPLE_RATE
+#define ALECTOV1_MIDHI PULSE_US(700)
+#define ALECTOV1_PULSEMAXMIN PULSE_US(2560)
 
 #ifdef PLUGIN_030
 #include "../4_Display.h"
 
-boolean Plugin_030(byte function, char *string)
+const PulseRange Plugin_030_Pulses[] PROGMEM = {{ALECTOV1_PULSECOUNT, ALECTOV1_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_030_Desc[] PROGMEM = PLUGIN_DESC_030;
+
+boolean Plugin_030(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != ALECTOV1_PULSECOUNT)
+   if (Packet.Number != ALECTOV1_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L;
@@ -124,19 +127,19 @@ boolean Plugin_030(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x <= 64; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] > ALECTOV1_MIDHI)
+      if (Packet.Pulses[x + 1] > ALECTOV1_MIDHI)
          return false; // in between pulses should be short
 
       bitstream >>= 1;
 
-      if (RawSignal.Pulses[x] > ALECTOV1_PULSEMAXMIN)
+      if (Packet.Pulses[x] > ALECTOV1_PULSEMAXMIN)
          bitstream |= (0x1L << 31); // Reverses order, as number are in LSB 1st, beware N2 and N3 !
    }
    for (byte x = 66; x <= 72; x = x + 2)
    {
       checksum >>= 1;
 
-      if (RawSignal.Pulses[x] > ALECTOV1_PULSEMAXMIN)
+      if (Packet.Pulses[x] > ALECTOV1_PULSEMAXMIN)
          checksum |= (0x1L << 3);
    }
    //==================================================================================
@@ -202,27 +205,21 @@ boolean Plugin_030(byte function, char *string)
                        //==================================================================================
       // Prevent repeating signals from showing up
       //==================================================================================
-      if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-      {
-         SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-         SignalCRC = bitstream;   // not seen the RF packet recently
-      }
-      else
-         return true; // already seen the RF packet recently
+      if (Output.RepeatMixed(bitstream, 1000))
+         return true; // already seen the RF packet recently, or the packet before it
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Alecto V1"));
-      display_IDc(c_ID);
-      display_TEMP(temperature);
+      Output.Header();
+      Output.Name(PSTR("Alecto V1"));
+      Output.IDc(c_ID);
+      Output.TEMP(temperature);
       if (humidity < 0x99)               // Some AlectoV1 devices actually lack the humidity sensor and always report 99%
-         display_HUM(humidity, HUM_BCD); // Only report humidity when it is below 99%
-      display_BAT(battery);
-      display_Footer();
+         Output.HUM(humidity, HUM_BCD); // Only report humidity when it is below 99%
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
+      Output.Repeats = true; // suppress repeats of the same RF packet
       return true;
    }
    else
@@ -230,16 +227,11 @@ boolean Plugin_030(byte function, char *string)
       //==================================================================================
       // Prevent repeating signals from showing up
       //==================================================================================
-      if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-      {
-         SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-         SignalCRC = bitstream;   // not seen the RF packet recently
-      }
-      else
-         return true; // already seen the RF packet recently
-      display_Header();
-      display_Name(PSTR("Alecto V1"));
-      display_IDc(c_ID);
+      if (Output.RepeatMixed(bitstream, 1000))
+         return true; // already seen the RF packet recently, or the packet before it
+      Output.Header();
+      Output.Name(PSTR("Alecto V1"));
+      Output.IDc(c_ID);
       if ((data[3]) == B0011)
       {                                                                      // Rain packet
          rain = (data[7] << 12) | (data[6] << 8) | (data[5] << 4) | data[4]; // 0.25mm step
@@ -247,7 +239,7 @@ boolean Plugin_030(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_RAIN(rain);
+         Output.RAIN(rain);
       }
       if ((data[3]) == B0001)
       {                                        // Windspeed packet
@@ -256,7 +248,7 @@ boolean Plugin_030(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_WINSP(windspeed);
+         Output.WINSP(windspeed);
       }
       if ((data[3]) == B0111)
       {                                                                                      // Winddir packet
@@ -267,14 +259,13 @@ boolean Plugin_030(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_WINDIR(winddirection);
-         display_WINGS(windgust);
+         Output.WINDIR(winddirection);
+         Output.WINGS(windgust);
       }
-      display_BAT(battery);
-      display_Footer();
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
+      Output.Repeats = true; // suppress repeats of the same RF packet
       return true;
    }
    return false;
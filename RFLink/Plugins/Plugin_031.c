@@ -68,11 +68,14 @@
 #define WS1100_PULSECOUNT 94
 #define WS1200_PULSECOUNT 126
 
-#define ALECTOV3_PULSEMID 300 / RAWSIGNAL_SAMPLE_RATE
+#define ALECTOV3_PULSEMID PULSE_US(300)
 
 #ifdef PLUGIN_031
 #include "../4_Display.h"
 
+const PulseRange Plugin_031_Pulses[] PROGMEM = {{WS1100_PULSECOUNT, WS1100_PULSECOUNT}, {WS1200_PULSECOUNT, WS1200_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_031_Desc[] PROGMEM = PLUGIN_DESC_031;
+
 uint8_t Plugin_031_ProtocolAlectoCRC8(uint8_t *addr, uint8_t len);
 // unsigned int Plugin_031_ProtocolAlectoRainBase = 0;
 
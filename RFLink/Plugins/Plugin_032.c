@@ -43,14 +43,17 @@
 #define PLUGIN_DESC_032 "Alecto V4"
 #define ALECTOV4_PULSECOUNT 74
 
-#define ALECTOV4_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
-#define ALECTOV4_PULSEMIN 1500 / RAWSIGNAL_SAMPLE_RATE
-#define ALECTOV4_PULSEMINMAX 2500 / RAWSIGNAL_SAMPLE_RATE
-#define ALECTOV4_PULSEMAXMIN 3000 / RAWSIGNAL_SAMPLE_RATE
+#define ALECTOV4_MIDHI PULSE_US(550)
+#define ALECTOV4_PULSEMIN PULSE_US(1500)
+#define ALECTOV4_PULSEMINMAX PULSE_US(2500)
+#define ALECTOV4_PULSEMAXMIN PULSE_US(3000)
 
 #ifdef PLUGIN_032
 #include "../4_Display.h"
 
+const PulseRange Plugin_032_Pulses[] PROGMEM = {{ALECTOV4_PULSECOUNT, ALECTOV4_PULSECOUNT + 4}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_032_Desc[] PROGMEM = PLUGIN_DESC_032;
+
 boolean Plugin_032(byte function, char *string)
 {
    if (RawSignal.Number < ALECTOV4_PULSECOUNT || RawSignal.Number > (ALECTOV4_PULSECOUNT + 4))
@@ -35,12 +35,15 @@
 #define PLUGIN_DESC_033 "Conrad"
 #define CONRAD_PULSECOUNT 80
 
-#define CONRAD_PULSEMAX 5000 / RAWSIGNAL_SAMPLE_RATE
-#define CONRAD_PULSEMIN 2300 / RAWSIGNAL_SAMPLE_RATE
+#define CONRAD_PULSEMAX PULSE_US(5000)
+#define CONRAD_PULSEMIN PULSE_US(2300)
 
 #ifdef PLUGIN_033
 #include "../4_Display.h"
 
+const PulseRange Plugin_033_Pulses[] PROGMEM = {{CONRAD_PULSECOUNT, CONRAD_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_033_Desc[] PROGMEM = PLUGIN_DESC_033;
+
 boolean Plugin_033(byte function, char *string)
 {
    if (RawSignal.Number != CONRAD_PULSECOUNT)
@@ -31,30 +31,34 @@
 #define CRESTA_MIN_PULSECOUNT 124 // unknown until we have a collection of all packet types but this seems to be the minimum
 #define CRESTA_MAX_PULSECOUNT 284 // unknown until we have a collection of all packet types
 
-#define CRESTA_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
+#define CRESTA_PULSEMID PULSE_US(700)
 
 #ifdef PLUGIN_034
 #include "../4_Display.h"
-#include "../7_Utils.h"
+#include "../9_Demod.h"
+
+const PulseRange Plugin_034_Pulses[] PROGMEM = {{CRESTA_MIN_PULSECOUNT, CRESTA_MAX_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_034_Desc[] PROGMEM = PLUGIN_DESC_034;
 
 byte Plugin_034_WindDirSeg(byte data);
 
-boolean Plugin_034(byte function, char *string)
+boolean Plugin_034(const PacketView &Packet, PluginOutput &Output)
 {
-   if ((RawSignal.Number < CRESTA_MIN_PULSECOUNT) || (RawSignal.Number > CRESTA_MAX_PULSECOUNT))
+   if ((Packet.Number < CRESTA_MIN_PULSECOUNT) || (Packet.Number > CRESTA_MAX_PULSECOUNT))
       return false;
 
-   byte bytecounter = 0;  // used for counting the number of received bytes
-   byte bitcounter = 0;   // counts number of received bits (converted from pulses)
-   int pulseposition = 1; // first pulse is always empty
-   byte halfbit = 0;      // high pulse = 1, 2 low pulses = 0, halfbit keeps track of low pulses
-   byte parity = 0;       // to calculate byte parity
+   DemodBits bits;
+   int bytecounter = 0; // used for counting the number of received bytes
 
    byte checksum = 0;
    byte data[18];
    byte length = 0;
    byte channel = 0;
    byte battery = 0;
+   byte L = Packet.SymbolAbove(CRESTA_PULSEMID); // first long symbol
+
+   if (L == 0 || L >= Packet.Clusters)
+      return false; // needs both short and long pulses
 
    int sensor_data = 0;
    int windtemp = 0;
@@ -64,76 +68,17 @@ boolean Plugin_034(byte function, char *string)
    unsigned int winddirection = 0;
    unsigned int uv = 0;
    //==================================================================================
-   // Get all 28 bits
-   // and determine if byte parity is set correctly
-   // for the cresta protocol on the fly
+   // Get all bytes, a long pulse is a 1 bit and 2 short pulses a 0 bit
+   // and check the parity bit after each byte
    //==================================================================================
-   do
-   {
-      if (RawSignal.Pulses[pulseposition] > CRESTA_PULSEMID)
-      {                    // high value = 1 bit
-         if (halfbit == 1) // cant receive a 1 bit after a single low value
-            return false;  // pulse error, must not be a Cresta packet or reception error
-
-         if (bitcounter == 8)
-         {
-            if (parity != 1) // now receiving parity bit
-               return false; // parity error, must not be a Cresta packet or reception error
-            else
-            {
-               bitcounter = 0; // reset for next byte
-               parity = 0;     // reset for next byte
-               halfbit = 0;    // wait for next first low or high pulse
-               bytecounter++;  // 1 byte received
-            }
-         }
-         else
-         {
-            data[bytecounter] <<= 1;
-            data[bytecounter] |= 0x1; // 1 bit
-            parity ^= 1;              // update parity
-            bitcounter++;             // received a bit
-            halfbit = 0;              // waiting for first low or a new high pulse
-         }
-      }
-      else
-      {
-         if (halfbit == 0) // 2 times a low value = 0 bit
-            halfbit = 1;   // first half received
-         else
-         {
-            if (bitcounter == 8)
-            {
-               if (parity != 0) // now receiving parity bit
-                  return false; // parity error, must not be a Cresta packet or reception error
-               else
-               {
-                  bitcounter = 0; // reset for next byte
-                  parity = 0;     // reset for next byte
-                  halfbit = 0;    // wait for next first low or high pulse
-                  bytecounter++;  // 1 byte received
-               }
-            }
-            else
-            {
-               data[bytecounter] <<= 1; // 0 bit
-               parity ^= 0;             // update parity
-               bitcounter++;            // received a bit
-               halfbit = 0;             // wait for next first low or high pulse
-            }
-         }
-      }
-      pulseposition++; // point to next pulse
-      if (pulseposition > RawSignal.Number)
-         break;                // reached the end? done processing
-   } while (bytecounter < 16); // receive maximum number of bytes from pulses
+   if (!Demod_BiphaseSymbols(Packet, 1, Packet.Number, L, DEMOD_INVERT, 16 * 9, bits))
+      return false; // pulse error, must not be a Cresta packet or reception error
+   bytecounter = Demod_Bytes(bits, 0, DEMOD_PARITY | DEMOD_LSB, data, 16); // receive maximum number of bytes from pulses
+   if (bytecounter < 0)
+      return false; // parity error, must not be a Cresta packet or reception error
    //==================================================================================
    // Perform checksum calculations
    //==================================================================================
-   // for (byte i = 0; i < bytecounter; i++)
-   //    data[i] = reverse8(data[i]);
-   reflect_bytes(data, bytecounter);
-
    // get packet length
    length = data[2] & 0x3F; // drop bits 6 and 7
    length >>= 1;            // drop bit 0
@@ -148,6 +93,7 @@ boolean Plugin_034(byte function, char *string)
 
    if (checksum != 0)
       return false;
+   Output.Checked = true;
    // ==================================================================================
    // now process the various sensor types
    // ==================================================================================
@@ -169,9 +115,7 @@ boolean Plugin_034(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = ((unsigned long)data[3] << 16) | ((data[1]) << 8) | channel;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen the RF packet recently
-   else
+   if (Output.Repeat(tmpval, 500))
       return true; // already seen the RF packet recently
    // ----------------------------------
    battery = !((data[2]) >> 6);
@@ -210,18 +154,18 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Cresta"));
+      Output.Header();
+      Output.Name(PSTR("Cresta"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
-      display_IDc(c_ID);
-      display_WINDIR(winddirection);
-      display_WINSP(windspeed);
-      display_WINGS(windgust);
-      display_WINTMP(windtemp);
-      display_WINCHL(windchill);
-      display_BAT(battery);
-      display_Footer();
+      Output.IDc(c_ID);
+      Output.WINDIR(winddirection);
+      Output.WINSP(windspeed);
+      Output.WINGS(windgust);
+      Output.WINTMP(windtemp);
+      Output.WINCHL(windchill);
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
    }
    else
@@ -241,15 +185,15 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Cresta"));
+      Output.Header();
+      Output.Name(PSTR("Cresta"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
-      display_IDc(c_ID);
-      display_TEMP(sensor_data);
-      display_UV(uv);
-      display_BAT(battery);
-      display_Footer();
+      Output.IDc(c_ID);
+      Output.TEMP(sensor_data);
+      Output.UV(uv);
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
    }
    else // 9F 80 CC 4E 00 00 66 64
@@ -262,14 +206,14 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Cresta"));
+      Output.Header();
+      Output.Name(PSTR("Cresta"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
-      display_IDc(c_ID);
-      display_RAIN(sensor_data);
-      display_BAT(battery);
-      display_Footer();
+      Output.IDc(c_ID);
+      Output.RAIN(sensor_data);
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
    }
    else
@@ -285,15 +229,15 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Cresta"));
+      Output.Header();
+      Output.Name(PSTR("Cresta"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
-      display_IDc(c_ID);
-      display_TEMP(sensor_data);
-      display_HUM(data[6], HUM_BCD);
-      display_BAT(battery);
-      display_Footer();
+      Output.IDc(c_ID);
+      Output.TEMP(sensor_data);
+      Output.HUM(data[6], HUM_BCD);
+      Output.BAT(battery);
+      Output.Footer();
       //==================================================================================
    }
    else
@@ -301,12 +245,12 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("Cresta;DEBUG"));
+      Output.Header();
+      Output.Name(PSTR("Cresta;DEBUG"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
-      display_IDc(c_ID);
-      display_Footer();
+      Output.IDc(c_ID);
+      Output.Footer();
       // ----------------------------------
       char dbuffer[3];
       for (byte i = 0; i < length + 2; i++)
@@ -318,8 +262,7 @@ boolean Plugin_034(byte function, char *string)
       Serial.println();
       //==================================================================================
    }
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 
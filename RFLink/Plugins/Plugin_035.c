@@ -41,12 +41,15 @@
 
 #define IMAGINTRONIX_PULSECOUNT 96
 
-#define IMAGINTRONIX_PULSEMID 1000 / RAWSIGNAL_SAMPLE_RATE
-#define IMAGINTRONIX_PULSESHORT 550 / RAWSIGNAL_SAMPLE_RATE
+#define IMAGINTRONIX_PULSEMID PULSE_US(1000)
+#define IMAGINTRONIX_PULSESHORT PULSE_US(550)
 
 #ifdef PLUGIN_035
 #include "../4_Display.h"
 
+const PulseRange Plugin_035_Pulses[] PROGMEM = {{IMAGINTRONIX_PULSECOUNT, IMAGINTRONIX_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_035_Desc[] PROGMEM = PLUGIN_DESC_035;
+
 boolean Plugin_035(byte function, char *string)
 {
    if (RawSignal.Number != IMAGINTRONIX_PULSECOUNT)
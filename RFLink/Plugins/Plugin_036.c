@@ -34,65 +34,41 @@
 #define PLUGIN_DESC_036 "F007_TH"
 #define F007_TH_PULSECOUNT 111
 
-#define F007_TH_PULSE_MID  650 / RAWSIGNAL_SAMPLE_RATE
+#define F007_TH_PULSE_MID  PULSE_US(650)
 
 #ifdef PLUGIN_036
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_036(byte function, char *string)
+const PulseRange Plugin_036_Pulses[] PROGMEM = {{F007_TH_PULSECOUNT, F007_TH_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_036_Desc[] PROGMEM = PLUGIN_DESC_036;
+const DemodTiming Plugin_036_Timing = {F007_TH_PULSE_MID - 1, 0, F007_TH_PULSE_MID, 0, 0}; // a pulse of F007_TH_PULSE_MID opens a long bit, or closes a short pair
+
+boolean Plugin_036(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != F007_TH_PULSECOUNT)
+   if (Packet.Number != F007_TH_PULSECOUNT)
       return false;
 
-   byte toggle = 1;
-   byte pulsecounter = 2;                                            // Pulse counter
-   int bitcounter = 0;                                               // Bits counter 
-   unsigned long headerstream = 0L ;                                 // Must be 111 1111 1101 0100 0101 (9 1's + '01' + 0x45) -> 19 Bits
-   unsigned long datastream = 0L;                                    // Only the 32 first bits are processed, not the checksum
+   unsigned long headerstream = 1L;                                  // Must be 111 1111 1101 0100 010 (9 1's + '01' + 0x45), after a 1
+   unsigned long datastream = 0L;                                    // Only the 32 last bits are processed, not the first one
 
    //==================================================================================
    // Get bits
    //==================================================================================
 
-   while(bitcounter < 51)
-   {
-      bitcounter++;
-      if (RawSignal.Pulses[pulsecounter] < F007_TH_PULSE_MID)
-      {                                                              // Short pulse in second half-bit -> same value
-         if (RawSignal.Pulses[pulsecounter+1] > F007_TH_PULSE_MID)   // First :Manchester check, the next pulse must alway be short
-            return false;                                            // Invalid Manchester code
-         pulsecounter += 2;                                          // Manchester OK -> don't toggle bit, move ahead to next half-bit
-      }
-      else
-      {                                                              // Long pulse in second half-bit -> invert bit value
-         toggle ^= 0x1;                                              // Invert bit value
-         pulsecounter += 1;                                          // Move ahead to next pulse
-      }
-      if ((bitcounter <= 9 || bitcounter == 11) && toggle == 0)      // Quick sanity checks : Bits 1-9 and 11 must be 1
-         return false;                                               // Invalid 0 in header (sometimes good data, but mised some bits)
-      if (bitcounter == 19)                                          // Longer sanity check : Header must be 0x7FD45
-      {
-         if (headerstream != 0x3FEA2)
-            return false;                                            // Invalid header
-      }      
-      if (bitcounter < 19)
-      {                                                              // Store in header
-         headerstream <<= 1;
-         headerstream |= toggle;                                     
-      }
-      else
-      {                                                              // Store data
-         datastream <<= 1;
-         datastream |= toggle;   
-      }
-   }
+   int x = Demod_Manchester(Packet, 2, 18, Plugin_036_Timing, headerstream);
+   if (!x)
+      return false;                                                  // Invalid Manchester code
+   if ((headerstream & 0x3FFFF) != 0x3FEA2)
+      return false;                                                  // Invalid header
+   datastream = headerstream & 1;                                    // The data goes on from the last header bit
+   if (!Demod_Manchester(Packet, x, 33, Plugin_036_Timing, datastream))
+      return false;
 
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != datastream))
-      SignalCRC = datastream;
-   else
+   if (Output.Repeat(datastream, 700))
       return true; // packet already seen
 
    //==================================================================================
@@ -111,17 +87,16 @@ boolean Plugin_036(byte function, char *string)
    //==================================================================================
    // Output
    //==================================================================================
-   display_Header();
-   display_Name(PSTR("F007_TH"));
-   display_IDn(ID, 4);
-   display_TEMP(realtemp);
-   display_HUM(hygro, HUM_HEX);
-   display_BAT(battery);
-   display_Footer();
+   Output.Header();
+   Output.Name(PSTR("F007_TH"));
+   Output.IDn(ID, 4);
+   Output.TEMP(realtemp);
+   Output.HUM(hygro, HUM_HEX);
+   Output.BAT(battery);
+   Output.Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_036
@@ -42,21 +42,28 @@
 #define PLUGIN_DESC_037 "AcuRite 986"
 #define ACURITE_PULSECOUNT 84
 
-#define ACURITE_MIDHI 2000 / RAWSIGNAL_SAMPLE_RATE
-#define ACURITE_PULSEMIN 150 / RAWSIGNAL_SAMPLE_RATE
-#define ACURITE_PULSEMINMAX 2500 / RAWSIGNAL_SAMPLE_RATE
-#define ACURITE_PULSEMAXMIN 650 / RAWSIGNAL_SAMPLE_RATE
+#define ACURITE_MIDHI PULSE_US(2000)
+#define ACURITE_PULSEMIN PULSE_US(150)
+#define ACURITE_PULSEMINMAX PULSE_US(2500)
+#define ACURITE_PULSEMAXMIN PULSE_US(650)
 
 #ifdef PLUGIN_037
 #include "../4_Display.h"
+#include "../7_Utils.h"
+#include "../9_Demod.h"
 
-boolean Plugin_037(byte function, char *string)
+const PulseRange Plugin_037_Pulses[] PROGMEM = {{ACURITE_PULSECOUNT, ACURITE_PULSECOUNT + 4}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_037_Desc[] PROGMEM = PLUGIN_DESC_037;
+const DemodTiming Plugin_037_Timing = {ACURITE_PULSEMAXMIN, 0, 0, ACURITE_MIDHI, 0}; // data bits
+const DemodTiming Plugin_037_CRCTiming = {ACURITE_PULSEMAXMIN, 0, 0, 0, 0};         // CRC bits
+
+boolean Plugin_037(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number < ACURITE_PULSECOUNT || RawSignal.Number > (ACURITE_PULSECOUNT + 4))
+   if (Packet.Number < ACURITE_PULSECOUNT || Packet.Number > (ACURITE_PULSECOUNT + 4))
       return false;
 
    unsigned long bitstream = 0L;
-   byte bitstream2 = 0;
+   unsigned long bitstream2 = 0L;
    byte data[4];
    int temperature = 0;
    unsigned long rc = 0;
@@ -67,37 +74,11 @@ boolean Plugin_037(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   // Serial.print("Bitstream: ");
-   for (byte x = 0; x < 64; x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > ACURITE_MIDHI)
-         return false; // in between pulses should be short
-      bitstream <<= 1;
-      if (RawSignal.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
-      {
-         bitstream |= 0x1;
-         // Serial.print("1");
-      }
-      else
-      {
-         // Serial.print("0");
-      }
-   }
-   // Serial.print(" ");
-   for (byte x = 64; x < 80; x = x + 2)
-   {
-      bitstream2 <<= 1;
-
-      if (RawSignal.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
-      {
-         bitstream2 |= 0x1;
-         // Serial.print("1");
-      }
-      else
-      {
-         // Serial.print("0");
-      }
-   }
+   // Frame from the splitter: Pulses[1] follows the sync, the data pulses are the even ones
+   int x = Demod_PPM(Packet, 2, 32, Plugin_037_Timing, 0, bitstream);
+   if (!x)
+      return false; // in between pulses should be short
+   Demod_PPM(Packet, x, 8, Plugin_037_CRCTiming, 0, bitstream2);
    // char dataPrint[9];
    //sprintf(dataPrint, "%04lx %01x", bitstream, bitstream2);
    //Serial.println("");
@@ -170,24 +151,21 @@ boolean Plugin_037(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0)); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Output.Repeat(tmpval, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
    //==================================================================================
-   display_Header();
-   display_Name(PSTR("AcuRite 986"));
+   Output.Header();
+   Output.Name(PSTR("AcuRite 986"));
    char c_ID[5];
    sprintf(c_ID, "%02x%02x", (rc & 0xFF), rc2);
-   display_IDc(c_ID);
-   display_TEMP(temperature);
-   display_BAT(battery);
-   display_Footer();
+   Output.IDc(c_ID);
+   Output.TEMP(temperature);
+   Output.BAT(battery);
+   Output.Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_037
@@ -48,14 +48,17 @@
 #define PLUGIN_DESC_040 "Mebus"
 #define MEBUS_PULSECOUNT 58
 
-#define MEBUS_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMIN 1500 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMINMAX 2100 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMAXMIN 3400 / RAWSIGNAL_SAMPLE_RATE
+#define MEBUS_MIDHI PULSE_US(550)
+#define MEBUS_PULSEMIN PULSE_US(1500)
+#define MEBUS_PULSEMINMAX PULSE_US(2100)
+#define MEBUS_PULSEMAXMIN PULSE_US(3400)
 
 #ifdef PLUGIN_040
 #include "../4_Display.h"
 
+const PulseRange Plugin_040_Pulses[] PROGMEM = {{MEBUS_PULSECOUNT, MEBUS_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_040_Desc[] PROGMEM = PLUGIN_DESC_040;
+
 boolean Plugin_040(byte function, char *string)
 {
    if (RawSignal.Number != MEBUS_PULSECOUNT)
@@ -87,11 +87,14 @@
 #define LACROSSE41_PULSECOUNT3 122 // Wind sensor
 #define LACROSSE41_PULSECOUNT4 132 // Brightness sensor
 
-#define LACROSSE41_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
+#define LACROSSE41_PULSEMID PULSE_US(500)
 
 #ifdef PLUGIN_041
 #include "../4_Display.h"
 
+const PulseRange Plugin_041_Pulses[] PROGMEM = {{LACROSSE41_PULSECOUNT1, LACROSSE41_PULSECOUNT1}, {LACROSSE41_PULSECOUNT3, LACROSSE41_PULSECOUNT3}, {LACROSSE41_PULSECOUNT4, LACROSSE41_PULSECOUNT4}, {LACROSSE41_PULSECOUNT2, LACROSSE41_PULSECOUNT2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_041_Desc[] PROGMEM = PLUGIN_DESC_041;
+
 boolean Plugin_041(byte function, char *string)
 {
    if ((RawSignal.Number != LACROSSE41_PULSECOUNT1) && (RawSignal.Number != LACROSSE41_PULSECOUNT2) &&
@@ -93,22 +93,26 @@
 #define UPM_MIN_PULSECOUNT 46
 #define UPM_MAX_PULSECOUNT 56
 
-#define UPM_PULSELOHI 1100 / RAWSIGNAL_SAMPLE_RATE
-#define UPM_PULSEHIHI 2075 / RAWSIGNAL_SAMPLE_RATE
-#define UPM_PULSEHILO 1600 / RAWSIGNAL_SAMPLE_RATE
+#define UPM_PULSELOHI PULSE_US(1100)
+#define UPM_PULSEHIHI PULSE_US(2075)
+#define UPM_PULSEHILO PULSE_US(1600)
 
 #ifdef PLUGIN_042
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_042(byte function, char *string)
+const PulseRange Plugin_042_Pulses[] PROGMEM = {{UPM_MIN_PULSECOUNT, UPM_MAX_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_042_Desc[] PROGMEM = PLUGIN_DESC_042;
+const PluginSignature Plugin_042_Signature PROGMEM = {0, 1200, 0, 0, 0, 0}; // the '1100' preamble starts on a short pulse, see UPM_PULSELOHI
+const DemodTiming Plugin_042_Timing = {UPM_PULSEHILO, 0, UPM_PULSELOHI, UPM_PULSEHIHI - 1, 0}; // a long pulse is a 0, two short ones a 1
+
+boolean Plugin_042(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number < UPM_MIN_PULSECOUNT || RawSignal.Number > UPM_MAX_PULSECOUNT)
+   if (Packet.Number < UPM_MIN_PULSECOUNT || Packet.Number > UPM_MAX_PULSECOUNT)
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 10 bits
    unsigned long bitstream2 = 0L; // holds last 26 bits
-   byte bitcounter = 0;           // counts number of received bits (converted from pulses)
-   byte halfbit = 0;              // high pulse = 1, 2 low pulses = 0, halfbit keeps track of low pulses
 
    byte rc = 0;
    int temperature = 0;
@@ -124,50 +128,9 @@ boolean Plugin_042(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number; x++)
-   {
-      if ((RawSignal.Pulses[x] > UPM_PULSEHILO) && (RawSignal.Pulses[x] < UPM_PULSEHIHI))
-      {
-         if (halfbit == 1) // UPM cant receive a 1 bit after a single low value
-            return false;  // pulse error, must not be a UPM packet or reception error
-
-         if (bitcounter < 10)
-         {
-            bitstream1 <<= 1;
-            bitcounter++; // only need to count the first 10 bits
-         }
-         else
-            bitstream2 <<= 1;
-
-         halfbit = 0; // wait for next first low or high pulse
-      }
-      else
-      {
-         if ((RawSignal.Pulses[x] > UPM_PULSELOHI))
-            return false; // Not a valid UPM pulse length
-
-         if (halfbit == 0) // 2 times a low value = 0 bit
-            halfbit = 1;   // first half received
-
-         else
-         {
-            if (bitcounter < 10)
-            {
-               bitstream1 <<= 1;
-               bitstream1 |= 0x1;
-               bitcounter++; // only need to count the first 10 bits
-            }
-            else
-            {
-               bitstream2 <<= 1;
-               bitstream2 |= 0x1;
-            }
-            halfbit = 0; // wait for next first low or high pulse
-         }
-      }
-      if (bitcounter > 36)
-         return false; // too many bits, it cant be the right protocol
-   }
+   int x = Demod_Biphase(Packet, 1, Packet.Number - 1, Plugin_042_Timing, 0, 10, bitstream1);
+   if (!x || !Demod_Biphase(Packet, x, Packet.Number - 1, Plugin_042_Timing, 0, 0xFF, bitstream2))
+      return false; // a pulse out of its window, or a single low pulse before a high one
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -204,12 +167,11 @@ boolean Plugin_042(byte function, char *string)
       else
          return false;
    }
+   Output.Checked = true;
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream1))
-      SignalCRC = bitstream1; // not seen the RF packet recently
-   else
+   if (Output.Repeat(bitstream1, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -229,13 +191,13 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_Header();
-         display_Name(PSTR("UPM/Esic"));
+         Output.Header();
+         Output.Name(PSTR("UPM/Esic"));
          char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
-         display_IDc(c_ID);
-         display_WINSP(winds);
-         display_WINDIR(windd);
+         Output.IDc(c_ID);
+         Output.WINSP(winds);
+         Output.WINDIR(windd);
          //==================================================================================
       }
       else if ((rc == 10) && (devicecode == 3))
@@ -246,12 +208,12 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_Header();
-         display_Name(PSTR("UPM/Esic"));
+         Output.Header();
+         Output.Name(PSTR("UPM/Esic"));
          char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
-         display_IDc(c_ID);
-         display_RAIN(rain);
+         Output.IDc(c_ID);
+         Output.RAIN(rain);
          //==================================================================================
       }
       else
@@ -269,13 +231,13 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          // Output
          //==================================================================================
-         display_Header();
-         display_Name(PSTR("UPM/Esic"));
+         Output.Header();
+         Output.Name(PSTR("UPM/Esic"));
          char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
-         display_IDc(c_ID);
-         display_TEMP(temperature);
-         display_HUM(humidity, HUM_HEX); // Humidity 0x15 = 21% decimal
+         Output.IDc(c_ID);
+         Output.TEMP(temperature);
+         Output.HUM(humidity, HUM_HEX); // Humidity 0x15 = 21% decimal
          //==================================================================================
       }
    }
@@ -292,22 +254,21 @@ boolean Plugin_042(byte function, char *string)
       //==================================================================================
       // Output
       //==================================================================================
-      display_Header();
-      display_Name(PSTR("UPM/Esic F2"));
+      Output.Header();
+      Output.Name(PSTR("UPM/Esic F2"));
       char c_ID[5];
       sprintf(c_ID, "%02X%02X", rc, devicecode);
-      display_IDc(c_ID);
-      display_TEMP(temperature);
-      display_HUM(humidity, HUM_HEX); // Humidity 0x15 = 21% decimal
+      Output.IDc(c_ID);
+      Output.TEMP(temperature);
+      Output.HUM(humidity, HUM_HEX); // Humidity 0x15 = 21% decimal
    }
    //==================================================================================
    // Output (common)
    //==================================================================================
-   display_BAT(battery);
-   display_Footer();
+   Output.BAT(battery);
+   Output.Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_042
@@ -92,15 +92,18 @@
 
 #define LACROSSE43_PULSECOUNT 88 // also handles 84 to 92 pulses!
 
-#define LACROSSE43_MIDLO 640 / RAWSIGNAL_SAMPLE_RATE       //900 //630
-#define LACROSSE43_MIDHI 1056 / RAWSIGNAL_SAMPLE_RATE      //1500 //1050
-#define LACROSSE43_PULSEMINMAX 576 / RAWSIGNAL_SAMPLE_RATE //810 //570
-#define LACROSSE43_PULSEMAXMIN 992 / RAWSIGNAL_SAMPLE_RATE //1410 //990
-#define LACROSSE43_PULSEMAX 1440 / RAWSIGNAL_SAMPLE_RATE   //2100 //1500
+#define LACROSSE43_MIDLO PULSE_US(640)       //900 //630
+#define LACROSSE43_MIDHI PULSE_US(1056)      //1500 //1050
+#define LACROSSE43_PULSEMINMAX PULSE_US(576) //810 //570
+#define LACROSSE43_PULSEMAXMIN PULSE_US(992) //1410 //990
+#define LACROSSE43_PULSEMAX PULSE_US(1440)   //2100 //1500
 
 #ifdef PLUGIN_043
 #include "../4_Display.h"
 
+const PulseRange Plugin_043_Pulses[] PROGMEM = {{LACROSSE43_PULSECOUNT - 4, LACROSSE43_PULSECOUNT + 4}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_043_Desc[] PROGMEM = PLUGIN_DESC_043;
+
 boolean Plugin_043(byte function, char *string)
 {
    if ((RawSignal.Number < LACROSSE43_PULSECOUNT - 4) || (RawSignal.Number > LACROSSE43_PULSECOUNT + 4))
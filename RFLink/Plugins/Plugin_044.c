@@ -38,15 +38,18 @@
 #define PLUGIN_DESC_044 "Auriol V3"
 #define AURIOLV3_PULSECOUNT 82
 
-#define AURIOLV3_MIDHI 650 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV3_MIDHI PULSE_US(650)
 
-#define AURIOLV3_PULSEMIN 1500 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV3_PULSEMINMAX 2000 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV3_PULSEMAXMIN 3500 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV3_PULSEMIN PULSE_US(1500)
+#define AURIOLV3_PULSEMINMAX PULSE_US(2000)
+#define AURIOLV3_PULSEMAXMIN PULSE_US(3500)
 
 #ifdef PLUGIN_044
 #include "../4_Display.h"
 
+const PulseRange Plugin_044_Pulses[] PROGMEM = {{AURIOLV3_PULSECOUNT, AURIOLV3_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_044_Desc[] PROGMEM = PLUGIN_DESC_044;
+
 boolean Plugin_044(byte function, char *string)
 {
    if (RawSignal.Number != AURIOLV3_PULSECOUNT)
@@ -64,7 +67,7 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x < AURIOLV3_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > AURIOLV3_MIDHI)
+      if (PULSE_TO_US(RawSignal.Pulses[x + 1]) > AURIOLV3_MIDHI)
          return false;
       if (RawSignal.Pulses[x] > AURIOLV3_PULSEMAXMIN)
       {
@@ -36,15 +36,18 @@
 #define PLUGIN_DESC_045 "Auriol"
 #define AURIOL_PULSECOUNT 66
 
-#define AURIOL_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOL_MIDHI PULSE_US(550)
 
-#define AURIOL_PULSEMIN 1600 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOL_PULSEMINMAX 2200 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOL_PULSEMAXMIN 3000 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOL_PULSEMIN PULSE_US(1600)
+#define AURIOL_PULSEMINMAX PULSE_US(2200)
+#define AURIOL_PULSEMAXMIN PULSE_US(3000)
 
 #ifdef PLUGIN_045
 #include "../4_Display.h"
 
+const PulseRange Plugin_045_Pulses[] PROGMEM = {{AURIOL_PULSECOUNT, AURIOL_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_045_Desc[] PROGMEM = PLUGIN_DESC_045;
+
 boolean Plugin_045(byte function, char *string)
 {
    if (RawSignal.Number != AURIOL_PULSECOUNT)
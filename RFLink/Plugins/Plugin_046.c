@@ -49,24 +49,28 @@
 
 #define AURIOLV2_PULSECOUNT 74
 
-#define AURIOLV2_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV2_MIDHI PULSE_US(700)
 
-#define AURIOLV2_PULSEMIN 500 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMINMAX 1100 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMAXMIN 1400 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMAX 2100 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV2_PULSEMIN PULSE_US(500)
+#define AURIOLV2_PULSEMINMAX PULSE_US(1100)
+#define AURIOLV2_PULSEMAXMIN PULSE_US(1400)
+#define AURIOLV2_PULSEMAX PULSE_US(2100)
 
 #ifdef PLUGIN_046
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_046(byte function, char *string)
+const PulseRange Plugin_046_Pulses[] PROGMEM = {{AURIOLV2_PULSECOUNT, AURIOLV2_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_046_Desc[] PROGMEM = PLUGIN_DESC_046;
+const DemodTiming Plugin_046_Timing = {AURIOLV2_PULSEMAXMIN, AURIOLV2_PULSEMIN, AURIOLV2_PULSEMINMAX, AURIOLV2_PULSEMAX, AURIOLV2_MIDHI};
+
+boolean Plugin_046(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != AURIOLV2_PULSECOUNT)
+   if (Packet.Number != AURIOLV2_PULSECOUNT)
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 6x4=24 bits
    unsigned long bitstream2 = 0L; // holds last  3x4=12 bits
-   byte bitcounter = 0;           // counts number of received bits (converted from pulses)
    byte rc = 0;
    byte bat = 0;
    byte bat0 = 0;
@@ -77,41 +81,9 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   for (byte x = 2; x < (AURIOLV2_PULSECOUNT); x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > AURIOLV2_MIDHI)
-         return false;
-      if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAXMIN)
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAX)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitstream1 |= 0x1;
-            bitcounter++; // only need to count the first 24 bits
-         }
-         else
-         {
-            bitstream2 <<= 1;
-            bitstream2 |= 0x1;
-         }
-      }
-      else
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMINMAX)
-            return false;
-         if (RawSignal.Pulses[x] < AURIOLV2_PULSEMIN)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitcounter++; // only need to count the first 10 bits
-         }
-         else
-            bitstream2 <<= 1;
-      }
-   }
+   int x = Demod_PPM(Packet, 2, 24, Plugin_046_Timing, 0, bitstream1);
+   if (!x || !Demod_PPM(Packet, x, 12, Plugin_046_Timing, 0, bitstream2))
+      return false; // mark too long or a pulse out of range
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -124,9 +96,7 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 8) | (bitstream2 & 0xFF); // All but "1111" padded section
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Output.Repeat(tmpval, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -137,7 +107,7 @@ boolean Plugin_046(byte function, char *string)
       type = 0; // Auriol has no humidity part
    else
       type = 1; // Xiron
-   // if (RawSignal.Pulses[0] != AURIOLV2_PLUGIN_ID)
+   // if (Packet.Pulses[0] != AURIOLV2_PLUGIN_ID)
    //   return false; // only accept plugin_001 translated Xiron packets
    //==================================================================================
    if (type == 0)
@@ -178,23 +148,22 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    // Output
    //==================================================================================
-   display_Header();
+   Output.Header();
    if (type == 0)
-      display_Name(PSTR("Auriol V2"));
+      Output.Name(PSTR("Auriol V2"));
    else
-      display_Name(PSTR("Xiron"));
+      Output.Name(PSTR("Xiron"));
    char c_ID[5];
    sprintf(c_ID, "%02X%02X", rc, channel);
-   display_IDc(c_ID);
-   display_TEMP(temperature);
+   Output.IDc(c_ID);
+   Output.TEMP(temperature);
    if (type == 1)
-      display_HUM(humidity, HUM_HEX);
-   display_BAT(bat);
-   display_CHAN(channel);
-   display_Footer();
+      Output.HUM(humidity, HUM_HEX);
+   Output.BAT(bat);
+   Output.CHAN(channel);
+   Output.Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_046
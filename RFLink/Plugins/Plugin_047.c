@@ -36,18 +36,21 @@
 #define PLUGIN_DESC_047 "Auriol V4"
 #define AURIOLV4_PULSECOUNT 88
 
-#define AURIOLV4_MIDLO 128 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV4_MIDHI 672 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV4_MIDLO PULSE_US(128)
+#define AURIOLV4_MIDHI PULSE_US(672)
 
-#define AURIOLV4_PULSEMIN 224 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV4_PULSEMINMAX 352 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV4_PULSEMAXMIN 576 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV4_PULSEMAX 768 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV4_PULSEMIN PULSE_US(224)
+#define AURIOLV4_PULSEMINMAX PULSE_US(352)
+#define AURIOLV4_PULSEMAXMIN PULSE_US(576)
+#define AURIOLV4_PULSEMAX PULSE_US(768)
 
 #ifdef PLUGIN_047
 #include "../4_Display.h"
 #include "../7_Utils.h"
 
+const PulseRange Plugin_047_Pulses[] PROGMEM = {{AURIOLV4_PULSECOUNT - 4, AURIOLV4_PULSECOUNT + 2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_047_Desc[] PROGMEM = PLUGIN_DESC_047;
+
 boolean Plugin_047(byte function, char *string)
 {
    if ((RawSignal.Number < AURIOLV4_PULSECOUNT - 4) || (RawSignal.Number > AURIOLV4_PULSECOUNT + 2))
@@ -31,14 +31,18 @@
 
 #define ALARMPIRV0_PULSECOUNT 26
 
-#define ALARMPIRV0_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV0_PULSEMAX 1000 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV0_PULSESHORT 550 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV0_PULSEMIN 250 / RAWSIGNAL_SAMPLE_RATE
+#define ALARMPIRV0_PULSEMID PULSE_US(700)
+#define ALARMPIRV0_PULSEMAX PULSE_US(1000)
+#define ALARMPIRV0_PULSESHORT PULSE_US(550)
+#define ALARMPIRV0_PULSEMIN PULSE_US(250)
 
 #ifdef PLUGIN_060
 #include "../4_Display.h"
 
+const PulseRange Plugin_060_Pulses[] PROGMEM = {{ALARMPIRV0_PULSECOUNT, ALARMPIRV0_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_060_Desc[] PROGMEM = PLUGIN_DESC_060;
+const PluginSignature Plugin_060_Signature PROGMEM = {0, 600, 0, 0, 0, 0}; // short start bit, see ALARMPIRV0_PULSESHORT
+
 boolean Plugin_060(byte function, char *string)
 {
    if (RawSignal.Number != ALARMPIRV0_PULSECOUNT)
@@ -41,13 +41,16 @@
 
 #define ALARMPIRV1_PULSECOUNT 50
 
-#define ALARMPIRV1_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV1_PULSEMAX 1300 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV1_PULSEMIN 150 / RAWSIGNAL_SAMPLE_RATE
+#define ALARMPIRV1_PULSEMID PULSE_US(600)
+#define ALARMPIRV1_PULSEMAX PULSE_US(1300)
+#define ALARMPIRV1_PULSEMIN PULSE_US(150)
 
 #ifdef PLUGIN_061
 #include "../4_Display.h"
 
+const PulseRange Plugin_061_Pulses[] PROGMEM = {{ALARMPIRV1_PULSECOUNT, ALARMPIRV1_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_061_Desc[] PROGMEM = PLUGIN_DESC_061;
+
 boolean Plugin_061(byte function, char *string)
 {
    if (RawSignal.Number != ALARMPIRV1_PULSECOUNT)
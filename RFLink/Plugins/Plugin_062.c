@@ -28,13 +28,16 @@
 
 #define ALARMPIRV2_PULSECOUNT 50
 
-#define ALARMPIRV2_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV2_PULSEMAX 2000 / RAWSIGNAL_SAMPLE_RATE
-#define ALARMPIRV2_PULSEMIN 150 / RAWSIGNAL_SAMPLE_RATE
+#define ALARMPIRV2_PULSEMID PULSE_US(700)
+#define ALARMPIRV2_PULSEMAX PULSE_US(2000)
+#define ALARMPIRV2_PULSEMIN PULSE_US(150)
 
 #ifdef PLUGIN_062
 #include "../4_Display.h"
 
+const PulseRange Plugin_062_Pulses[] PROGMEM = {{ALARMPIRV2_PULSECOUNT, ALARMPIRV2_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_062_Desc[] PROGMEM = PLUGIN_DESC_062;
+
 boolean Plugin_062(byte function, char *string)
 {
    if (RawSignal.Number != ALARMPIRV2_PULSECOUNT)
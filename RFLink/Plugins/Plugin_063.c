@@ -27,6 +27,10 @@
 #ifdef PLUGIN_063
 #include "../4_Display.h"
 
+const PulseRange Plugin_063_Pulses[] PROGMEM = {{OREGON_PLA_PULSECOUNT - 2, OREGON_PLA_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_063_Desc[] PROGMEM = PLUGIN_DESC_063;
+const PluginSignature Plugin_063_Signature PROGMEM = {0, 600, 0, 0, 0, 0}; // pulses 1..28 are short
+
 boolean Plugin_063(byte function, char *string)
 {
    if ((RawSignal.Number < OREGON_PLA_PULSECOUNT - 2) || (RawSignal.Number > OREGON_PLA_PULSECOUNT))
@@ -42,9 +46,9 @@ boolean Plugin_063(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x < 28; x += 2)
    {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
+      if (PULSE_TO_US(RawSignal.Pulses[x]) > 600)
          return false;
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 600)
+      if (PULSE_TO_US(RawSignal.Pulses[x + 1]) > 600)
          return false;
    }
    //==================================================================================
@@ -55,19 +59,19 @@ boolean Plugin_063(byte function, char *string)
    //==================================================================================
    for (byte x = 29; x <= RawSignal.Number; x++)
    {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
+      if (PULSE_TO_US(RawSignal.Pulses[x]) > 600)
       { // toggle bit value
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 1600)
+         if (PULSE_TO_US(RawSignal.Pulses[x]) > 1600)
             break; // done..
          rfbit = (~rfbit) & 1;
          bitstream = (bitstream << 1) | rfbit;
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
+         if (PULSE_TO_US(RawSignal.Pulses[x + 1]) < 600)
             x++;
       }
       else
       {
          bitstream = (bitstream << 1) | rfbit; // short pulse keep bit value
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
+         if (PULSE_TO_US(RawSignal.Pulses[x + 1]) < 600)
             x++;
       }
    }
@@ -24,16 +24,19 @@
 #define PLUGIN_DESC_064 "Atlantic"
 #define ATLANTIC_PULSECOUNT 74
 
-#define ATLANTIC_PULSE_MID 600 / RAWSIGNAL_SAMPLE_RATE
-#define ATLANTIC_PULSE_MIN 300 / RAWSIGNAL_SAMPLE_RATE
-#define ATLANTIC_PULSE_MAX 900 / RAWSIGNAL_SAMPLE_RATE
+#define ATLANTIC_PULSE_MID PULSE_US(600)
+#define ATLANTIC_PULSE_MIN PULSE_US(300)
+#define ATLANTIC_PULSE_MAX PULSE_US(900)
 
 #ifdef PLUGIN_064
 #include "../4_Display.h"
 
-boolean Plugin_064(byte function, char *string)
+const PulseRange Plugin_064_Pulses[] PROGMEM = {{ATLANTIC_PULSECOUNT, ATLANTIC_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_064_Desc[] PROGMEM = PLUGIN_DESC_064;
+
+boolean Plugin_064(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != ATLANTIC_PULSECOUNT)
+   if (Packet.Number != ATLANTIC_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L; // Only the 32 first bits are processed
@@ -45,19 +48,19 @@ boolean Plugin_064(byte function, char *string)
 
    for (byte x = 2; x <= 64; x += 2)
    {
-      if (RawSignal.Pulses[x] > ATLANTIC_PULSE_MID)
+      if (Packet.Pulses[x] > ATLANTIC_PULSE_MID)
       { // long pulse = 1
-         if (RawSignal.Pulses[x] > ATLANTIC_PULSE_MAX)
+         if (Packet.Pulses[x] > ATLANTIC_PULSE_MAX)
             return false; // pulse too long
-         if (RawSignal.Pulses[x + 1] > ATLANTIC_PULSE_MAX)
+         if (Packet.Pulses[x + 1] > ATLANTIC_PULSE_MAX)
             return false; // invalid manchester code
          bitstream = (bitstream << 1) | 0x1;
       }
       else
       { // short pulse = 0
-         if (RawSignal.Pulses[x] < ATLANTIC_PULSE_MIN)
+         if (Packet.Pulses[x] < ATLANTIC_PULSE_MIN)
             return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] < ATLANTIC_PULSE_MID)
+         if (Packet.Pulses[x + 1] < ATLANTIC_PULSE_MID)
             return false; // invalid manchester code
          bitstream = bitstream << 1;
       }
@@ -65,9 +68,7 @@ boolean Plugin_064(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;
-   else
+   if (Output.Repeat(bitstream, 700))
       return true; // packet already seen
    //==================================================================================
    // Extract data
@@ -77,15 +78,14 @@ boolean Plugin_064(byte function, char *string)
    // ----------------------------------
    // Output
    // ----------------------------------
-   display_Header();
-   display_Name(PSTR("Atlantic"));
-   display_IDn(ID, 6);
-   display_SWITCH(1);
-   display_CMD(CMD_Single, alarm ? CMD_On : CMD_Off);
-   display_Footer();
+   Output.Header();
+   Output.Name(PSTR("Atlantic"));
+   Output.IDn(ID, 6);
+   Output.SWITCH(1);
+   Output.CMD(CMD_Single, alarm ? CMD_On : CMD_Off);
+   Output.Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_064
@@ -13,7 +13,7 @@
  *                      Usage of any parts of this code in a commercial application is prohibited!
  *********************************************************************************************
  * Technical data:
- * Devices send 48 pulses, 24 bits total.
+ * Devices send 48 pulses, 24 bits total, then a closing pulse and a gap of 4 to 5 mSec.
  *
  * Sample:
  * 20;XX;DEBUG;Pulses=49;Pulses(uSec)=192,448,160,480,480,160,480,160,448,192,128,512,128,544,96,544,448,192,128,512,160,512,480,160,128,512,480,160,480,192,128,512,480,160,480,160,128,512,448,192,128,512,128,512,128,512,448,192,96;
@@ -24,71 +24,55 @@
 #define PLUGIN_DESC_065 "GARAGE640"
 
 #define GARAGE640_PULSECOUNT 48
+#define GARAGE640_FRAME (GARAGE640_PULSECOUNT + 2) // closing pulse and gap
 
-#define GARAGE640_PULSEMID (320 / RAWSIGNAL_SAMPLE_RATE)
-#define GARAGE640_PULSEMAX (540 / RAWSIGNAL_SAMPLE_RATE)
-#define GARAGE640_PULSEMIN (60 / RAWSIGNAL_SAMPLE_RATE)
+#define GARAGE640_PULSEMID (PULSE_US(320))
+#define GARAGE640_PULSEMAX (PULSE_US(540))
+#define GARAGE640_PULSEMIN (PULSE_US(60))
+#define GARAGE640_GAPMIN (PULSE_US(4000))
+#define GARAGE640_GAPMAX (PULSE_US(5000))
 
 #ifdef PLUGIN_065
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_065(byte function, char *string) {
-   if (RawSignal.Number != GARAGE640_PULSECOUNT || RawSignal.Pulses[0] != 65)
+const PulseRange Plugin_065_Pulses[] PROGMEM = {{GARAGE640_FRAME, GARAGE640_FRAME}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_065_Desc[] PROGMEM = PLUGIN_DESC_065;
+const DemodTiming Plugin_065_Timing = {GARAGE640_PULSEMID, GARAGE640_PULSEMIN, 0, GARAGE640_PULSEMAX, 0};
+const PluginSignature Plugin_065_Signature PROGMEM = {0, 600, 0, 0, 0, 0}; // every data pulse below GARAGE640_PULSEMAX
+
+boolean Plugin_065(const PacketView &Packet, PluginOutput &Output) {
+   if (Packet.Number != GARAGE640_FRAME)
       return false;
+   if (Packet.Pulses[GARAGE640_FRAME] <= GARAGE640_GAPMIN || Packet.Pulses[GARAGE640_FRAME] >= GARAGE640_GAPMAX)
+      return false; // a frame ends on its gap
 
 
    unsigned long bitstream = 0L;
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (byte x = 1; x < GARAGE640_PULSECOUNT; x += 2)
-   {
-      if (RawSignal.Pulses[x] > GARAGE640_PULSEMID)
-      {
-         if (RawSignal.Pulses[x] > GARAGE640_PULSEMAX)
-            return false; // pulse too long
-         if (RawSignal.Pulses[x + 1] > GARAGE640_PULSEMID)
-            return false; // invalid pulse sequence 10/01
-         bitstream = (bitstream << 1) | 0x1;
-      }
-      else
-      {
-         if (RawSignal.Pulses[x] < GARAGE640_PULSEMIN)
-            return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] < GARAGE640_PULSEMID)
-            return false; // invalid pulse sequence 10/01
-         bitstream = bitstream << 1;
-      }
-   }
+   if (!Demod_PWM(Packet, 1, 24, Plugin_065_Timing, 0, bitstream))
+      return false; // invalid pulse sequence 10/01, or a pulse out of range
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (Output.Repeat(bitstream, 200))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Validity checks
    //==================================================================================
    // Output
    // ----------------------------------
-   display_Header();
-   display_Name(PSTR("GARAGE640"));
-   display_IDn((bitstream & 0xFFFFFF), 6); // "%S%06lx"
-   display_Footer();
+   Output.Header();
+   Output.Name(PSTR("GARAGE640"));
+   Output.IDn((bitstream & 0xFFFFFF), 6); // "%S%06lx"
+   Output.Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_065
@@ -46,40 +46,29 @@
 #define PLUGIN_DESC_070 "SelectPlus"
 #define SELECTPLUS_PULSECOUNT 36
 
-#define SELECTPLUS_PULSEMID 650 / RAWSIGNAL_SAMPLE_RATE
-#define SELECTPLUS_PULSEMAX 2125 / RAWSIGNAL_SAMPLE_RATE
+#define SELECTPLUS_PULSEMID PULSE_US(650)
+#define SELECTPLUS_PULSEMAX PULSE_US(2125)
 
 #ifdef PLUGIN_070
 #include "../4_Display.h"
+#include "../9_Demod.h"
 
-boolean Plugin_070(byte function, char *string)
+const PulseRange Plugin_070_Pulses[] PROGMEM = {{SELECTPLUS_PULSECOUNT, SELECTPLUS_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_070_Desc[] PROGMEM = PLUGIN_DESC_070;
+const DemodTiming Plugin_070_Timing = {SELECTPLUS_PULSEMID - 1, 0, SELECTPLUS_PULSEMID, SELECTPLUS_PULSEMAX, 0}; // a pulse of SELECTPLUS_PULSEMID is long, and both in a pair
+
+boolean Plugin_070(const PacketView &Packet, PluginOutput &Output)
 {
-    if (RawSignal.Number != SELECTPLUS_PULSECOUNT)
+    if (Packet.Number != SELECTPLUS_PULSECOUNT)
         return false;
 
     unsigned long bitstream = 0L;
     byte checksum = 0;
     //==================================================================================
-    // Get all 18 bits
+    // Get all 17 bits
     //==================================================================================
-    for (byte x = 2; x < SELECTPLUS_PULSECOUNT; x = x + 2)
-    {
-        bitstream <<= 1; // Always shift
-        if (RawSignal.Pulses[x] < SELECTPLUS_PULSEMID)
-        {
-            if (RawSignal.Pulses[x + 1] < SELECTPLUS_PULSEMID)
-                return false; // invalid pulse sequence 10/01
-            // bitstream |= 0x0;
-        }
-        else
-        {
-            if (RawSignal.Pulses[x] > SELECTPLUS_PULSEMAX)
-                return false; // invalid pulse duration, pulse too long
-            if (RawSignal.Pulses[x + 1] > SELECTPLUS_PULSEMID)
-                return false; // invalid pulse sequence 10/01
-            bitstream |= 0x1;
-        }
-    }
+    if (!Demod_PWM(Packet, 2, 17, Plugin_070_Timing, 0, bitstream))
+        return false; // invalid pulse sequence 10/01, or a pulse too long
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -88,10 +77,8 @@ boolean Plugin_070(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
-        return true; // already seen the RF packet recently
+    if (Output.Repeat(bitstream, 1000))
+       return true; // already seen the RF packet recently
     //==================================================================================
     // all bytes received, make sure checksum is okay
     //==================================================================================
@@ -101,16 +88,15 @@ boolean Plugin_070(byte function, char *string)
     //==================================================================================
     // Output
     //==================================================================================
-    display_Header();
-    display_Name(PSTR("SelectPlus"));
-    display_IDn(((bitstream >> 4) & 0xFFFF), 4);
-    display_SWITCH(1);
-    display_CMD(CMD_Single, CMD_On); // #ALL #ON
-    display_CHIME(1);
-    display_Footer();
+    Output.Header();
+    Output.Name(PSTR("SelectPlus"));
+    Output.IDn(((bitstream >> 4) & 0xFFFF), 4);
+    Output.SWITCH(1);
+    Output.CMD(CMD_Single, CMD_On); // #ALL #ON
+    Output.CHIME(1);
+    Output.Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;     // do not process the packet any further
+    Output.Repeats = true; // suppress repeats of the same RF packet
     return true;
 }
 #endif // PLUGIN_070
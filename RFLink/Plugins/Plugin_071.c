@@ -40,12 +40,15 @@
 
 #define PLIEGER_PULSECOUNT 66
 
-#define PLIEGER_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
-#define PLIEGER_PULSEMAX 1900 / RAWSIGNAL_SAMPLE_RATE
+#define PLIEGER_PULSEMID PULSE_US(700)
+#define PLIEGER_PULSEMAX PULSE_US(1900)
 
 #ifdef PLUGIN_071
 #include "../4_Display.h"
 
+const PulseRange Plugin_071_Pulses[] PROGMEM = {{PLIEGER_PULSECOUNT, PLIEGER_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_071_Desc[] PROGMEM = PLUGIN_DESC_071;
+
 boolean Plugin_071(byte function, char *string)
 {
    if (RawSignal.Number != PLIEGER_PULSECOUNT)
@@ -42,13 +42,17 @@
 #ifdef PLUGIN_072
 #include "../4_Display.h"
 
-boolean Plugin_072(byte function, char *string)
+const PulseRange Plugin_072_Pulses[] PROGMEM = {{BYRON_PULSECOUNT, BYRON_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_072_Desc[] PROGMEM = PLUGIN_DESC_072;
+const PluginSignature Plugin_072_Signature PROGMEM = {0, 425, 0, 0, 0, 0}; // short start bit
+
+boolean Plugin_072(const PacketView &Packet, PluginOutput &Output)
 {
-   if (RawSignal.Number != BYRON_PULSECOUNT)
+   if (Packet.Number != BYRON_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] != BYRON_PLUGIN_ID)
-      return false; // only accept plugin1 translated packets
-   if (RawSignal.Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 425)
+   if (PULSE_TO_US(Packet.Pulses[BYRON_PULSECOUNT]) < 2500 || PULSE_TO_US(Packet.Pulses[BYRON_PULSECOUNT]) > BYRONSTART)
+      return false; // a frame ends on its gap
+   if (PULSE_TO_US(Packet.Pulses[1]) > 425)
       return false; // first pulse is start bit and must be short
 
    unsigned long bitstream = 0L;
@@ -58,21 +62,21 @@ boolean Plugin_072(byte function, char *string)
    for (byte x = 2; x < BYRON_PULSECOUNT; x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 350)
+      if (PULSE_TO_US(Packet.Pulses[x]) < 350)
       { // 200-275 (150-350 is accepted)
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 150)
+         if (PULSE_TO_US(Packet.Pulses[x]) < 150)
             return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 350)
+         if (PULSE_TO_US(Packet.Pulses[x + 1]) < 350)
             return false; // bad manchester code
          // bitstream |= 0x0;
       }
       else
       { // 500-575 (450-650 is accepted)
-         if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 450)
+         if (PULSE_TO_US(Packet.Pulses[x + 1]) > 450)
             return false; // bad manchester code
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 450)
+         if (PULSE_TO_US(Packet.Pulses[x]) < 450)
             return false; // pulse too short
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 650)
+         if (PULSE_TO_US(Packet.Pulses[x]) > 650)
             return false; // pulse too long
          bitstream |= 0x1;
       }
@@ -85,23 +89,20 @@ boolean Plugin_072(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Output.Repeat(bitstream, 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
    //==================================================================================
-   display_Header();
-   display_Name(PSTR("Byron SX"));
-   display_IDn(((bitstream >> 4) & 0xFF), 4);
-   display_SWITCH(1);
-   display_CMD(CMD_Single, CMD_On); // #ALL #ON
-   display_CHIME((bitstream & 0xF));
-   display_Footer();
+   Output.Header();
+   Output.Name(PSTR("Byron SX"));
+   Output.IDn(((bitstream >> 4) & 0xFF), 4);
+   Output.SWITCH(1);
+   Output.CMD(CMD_Single, CMD_On); // #ALL #ON
+   Output.CHIME((bitstream & 0xF));
+   Output.Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   Output.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_072
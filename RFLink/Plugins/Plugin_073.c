@@ -41,6 +41,9 @@
 #ifdef PLUGIN_073
 #include "../4_Display.h"
 
+const PulseRange Plugin_073_Pulses[] PROGMEM = {{DELTRONIC_PULSECOUNT, DELTRONIC_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_073_Desc[] PROGMEM = PLUGIN_DESC_073;
+
 boolean Plugin_073(byte function, char *string)
 {
     if (RawSignal.Number != DELTRONIC_PULSECOUNT)
@@ -49,7 +52,7 @@ boolean Plugin_073(byte function, char *string)
     unsigned long bitstream = 0L;
     unsigned long checksum = 0L;
     //==================================================================================
-    if (RawSignal.Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 675)
+    if (PULSE_TO_US(RawSignal.Pulses[1]) > 675)
         return false; // First pulse is start bit and should be short!
                       //==================================================================================
                       // Get all 12 bits
@@ -57,20 +60,20 @@ boolean Plugin_073(byte function, char *string)
     for (byte x = 2; x < DELTRONIC_PULSECOUNT; x = x + 2)
     {
         bitstream <<= 1; // Always shift
-        if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 800)
+        if (PULSE_TO_US(RawSignal.Pulses[x]) > 800)
         { // long pulse  (800-1275)
-            if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 1275)
+            if (PULSE_TO_US(RawSignal.Pulses[x]) > 1275)
                 return false; // pulse too long to be valid
-            if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 675)
+            if (PULSE_TO_US(RawSignal.Pulses[x + 1]) > 675)
                 return false; // invalid manchestercode (10 01)
 
             bitstream |= 0x1; // 10 => 1 bit
         }
         else
         { // short pulse
-            if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 250)
+            if (PULSE_TO_US(RawSignal.Pulses[x]) < 250)
                 return false; // too short
-            if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 700)
+            if (PULSE_TO_US(RawSignal.Pulses[x + 1]) < 700)
                 return false; // invalid manchestercode (10 01)
 
             // bitstream |= 0x0; // 01 => 0 bit
@@ -43,6 +43,9 @@
 #ifdef PLUGIN_074
 #include "../4_Display.h"
 
+const PulseRange Plugin_074_Pulses[] PROGMEM = {{RL02_CodeLength * 4 + 2, RL02_CodeLength * 4 + 2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_074_Desc[] PROGMEM = PLUGIN_DESC_074;
+
 boolean Plugin_074(byte function, char *string)
 {
     if (RawSignal.Number != (RL02_CodeLength * 4) + 2)
@@ -53,7 +56,7 @@ boolean Plugin_074(byte function, char *string)
     //==================================================================================
     // Get all 12 bits
     //==================================================================================
-    byte j = (RL02_T * 2) / RAWSIGNAL_SAMPLE_RATE;
+    RawPulse j = PULSE_US(RL02_T * 2);
     for (byte i = 0; i < RL02_CodeLength; i++)
     {
 
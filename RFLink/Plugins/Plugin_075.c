@@ -45,6 +45,9 @@
 #ifdef PLUGIN_075
 #include "../4_Display.h"
 
+const PulseRange Plugin_075_Pulses[] PROGMEM = {{LIDL_PULSECOUNT, LIDL_PULSECOUNT}, {LIDL_PULSECOUNT2, LIDL_PULSECOUNT2}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_075_Desc[] PROGMEM = PLUGIN_DESC_075;
+
 boolean Plugin_075(byte function, char *string)
 {
    if ((RawSignal.Number != LIDL_PULSECOUNT) && (RawSignal.Number != LIDL_PULSECOUNT2))
@@ -59,10 +62,10 @@ boolean Plugin_075(byte function, char *string)
    //==================================================================================
    if (RawSignal.Number == LIDL_PULSECOUNT)
    {
-      if (RawSignal.Pulses[1] * RawSignal.Multiply > 1000 && RawSignal.Pulses[2] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[3] * RawSignal.Multiply > 1000 && RawSignal.Pulses[4] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[5] * RawSignal.Multiply > 1000 && RawSignal.Pulses[6] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[7] * RawSignal.Multiply > 1000 && RawSignal.Pulses[8] * RawSignal.Multiply > 1000 && RawSignal.Pulses[9] * RawSignal.Multiply > 1000)
+      if (PULSE_TO_US(RawSignal.Pulses[1]) > 1000 && PULSE_TO_US(RawSignal.Pulses[2]) > 1000 &&
+          PULSE_TO_US(RawSignal.Pulses[3]) > 1000 && PULSE_TO_US(RawSignal.Pulses[4]) > 1000 &&
+          PULSE_TO_US(RawSignal.Pulses[5]) > 1000 && PULSE_TO_US(RawSignal.Pulses[6]) > 1000 &&
+          PULSE_TO_US(RawSignal.Pulses[7]) > 1000 && PULSE_TO_US(RawSignal.Pulses[8]) > 1000 && PULSE_TO_US(RawSignal.Pulses[9]) > 1000)
       {
          //
       }
@@ -74,7 +77,7 @@ boolean Plugin_075(byte function, char *string)
          if (bitcount < 28)
          {
             bitstream <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (PULSE_TO_US(RawSignal.Pulses[x]) > 550)
             {
                // bitstream |= 0x0;
             }
@@ -87,7 +90,7 @@ boolean Plugin_075(byte function, char *string)
          else
          {
             bitstream2 <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (PULSE_TO_US(RawSignal.Pulses[x]) > 550)
             {
                // bitstream2 |= 0x0;
             }
@@ -106,9 +109,9 @@ boolean Plugin_075(byte function, char *string)
       type = 1;
       for (byte x = 1; x < LIDL_PULSECOUNT2 - 1; x += 2)
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 200)
+         if (PULSE_TO_US(RawSignal.Pulses[x]) > 200)
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 200)
+            if (PULSE_TO_US(RawSignal.Pulses[x + 1]) > 200)
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -122,7 +125,7 @@ boolean Plugin_075(byte function, char *string)
          }
          else
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 200)
+            if (PULSE_TO_US(RawSignal.Pulses[x + 1]) < 200)
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -39,15 +39,18 @@
 
 #define FA20_PULSECOUNT 52
 
-#define FA20_MIDHI 1000 / RAWSIGNAL_SAMPLE_RATE
-#define FA20_PULSEMIN 1000 / RAWSIGNAL_SAMPLE_RATE
-#define FA20_PULSEMINMAX 1500 / RAWSIGNAL_SAMPLE_RATE
-#define FA20_PULSEMAXMIN 2000 / RAWSIGNAL_SAMPLE_RATE
-#define FA20_PULSEMAX 2800 / RAWSIGNAL_SAMPLE_RATE
+#define FA20_MIDHI PULSE_US(1000)
+#define FA20_PULSEMIN PULSE_US(1000)
+#define FA20_PULSEMINMAX PULSE_US(1500)
+#define FA20_PULSEMAXMIN PULSE_US(2000)
+#define FA20_PULSEMAX PULSE_US(2800)
 
 #ifdef PLUGIN_080
 #include "../4_Display.h"
 
+const PulseRange Plugin_080_Pulses[] PROGMEM = {{FA20_PULSECOUNT, FA20_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_080_Desc[] PROGMEM = PLUGIN_DESC_080;
+
 boolean Plugin_080(byte function, char *string)
 {
    if (RawSignal.Number != FA20_PULSECOUNT)
@@ -46,12 +46,15 @@
 #define MAXITROL1_PULSECOUNT 46
 
 #define MAXITROL1_MID 550
-#define MAXITROL1_PULSEMINMAX 550 / RAWSIGNAL_SAMPLE_RATE
-#define MAXITROL1_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
+#define MAXITROL1_PULSEMINMAX PULSE_US(550)
+#define MAXITROL1_PULSEMAX PULSE_US(900)
 
 #ifdef PLUGIN_081
 #include "../4_Display.h"
 
+const PulseRange Plugin_081_Pulses[] PROGMEM = {{MAXITROL1_PULSECOUNT, MAXITROL1_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_081_Desc[] PROGMEM = PLUGIN_DESC_081;
+
 boolean Plugin_081(byte function, char *string)
 {
    if (RawSignal.Number != MAXITROL1_PULSECOUNT)
@@ -46,12 +46,16 @@
 #define MAXITROL2_PULSECOUNT 26
 
 #define MAXITROL2_MID 550
-#define MAXITROL2_PULSEMINMAX 550 / RAWSIGNAL_SAMPLE_RATE
-#define MAXITROL2_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
+#define MAXITROL2_PULSEMINMAX PULSE_US(550)
+#define MAXITROL2_PULSEMAX PULSE_US(900)
 
 #ifdef PLUGIN_082
 #include "../4_Display.h"
 
+const PulseRange Plugin_082_Pulses[] PROGMEM = {{MAXITROL2_PULSECOUNT, MAXITROL2_PULSECOUNT}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_082_Desc[] PROGMEM = PLUGIN_DESC_082;
+const PluginSignature Plugin_082_Signature PROGMEM = {0, 600, 0, 0, 0, 0}; // short start pulse, see MAXITROL2_PULSEMINMAX
+
 boolean Plugin_082(byte function, char *string)
 {
    if (RawSignal.Number != MAXITROL2_PULSECOUNT)
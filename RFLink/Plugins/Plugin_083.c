@@ -28,10 +28,10 @@
  * 20;XX;DEBUG;Pulses=82;Pulses(uSec)=4640,1504,192,640,192,640,512,320,192,608,512,320,192,640,480,320,480,352,160,640,512,320,192,640,160,640,192,640,160,640,160,640,192,640,512,320,480,320,160,640,160,640,480,320,160,640,160,640,160,672,160,640,192,640,192,640,192,640,192,640,192,640,192,640,512,352,160,640,160,640,160,640,512,320,512,320,512,320,480,320,160,4992;
  \*********************************************************************************************/
 #define DOOYA_PLUGIN_ID 083
-#define PLUGIN_DESC_083 PSTR("BRELMOTOR")
+#define PLUGIN_DESC_083 "BRELMOTOR"
 #define DOOYA_PULSECOUNT_1 82
 
-#define DOOYA_MIDVALUE 384 / RAWSIGNAL_SAMPLE_RATE
+#define DOOYA_MIDVALUE PULSE_US(384)
 
 #define DOOYA_UP_COMMAND    0x11 // 0001 0001
 #define DOOYA_STOP_COMMAND  0x55 // 0101 0101
@@ -42,6 +42,9 @@
 #ifdef PLUGIN_083
 #include "../4_Display.h"
 
+const PulseRange Plugin_083_Pulses[] PROGMEM = {{DOOYA_PULSECOUNT_1, DOOYA_PULSECOUNT_1}, PULSES_END}; // RawSignal.Number accepted
+const char Plugin_083_Desc[] PROGMEM = PLUGIN_DESC_083;
+
 boolean Plugin_083(byte function, char *string)
 {
    char dbuffer[64];
@@ -25,6 +25,8 @@
 #ifdef PLUGIN_254
 #include "../4_Display.h"
 
+const char Plugin_254_Desc[] PROGMEM = PLUGIN_DESC_254;
+
 boolean Plugin_254(byte function, char *string)
 {
    int i;
@@ -46,7 +48,7 @@ boolean Plugin_254(byte function, char *string)
    Serial.print(RawSignal.Number);         // print number of pulses
    Serial.print(F(";Pulses(uSec)="));      // print pulse durations
    // ----------------------------------
-   char dbuffer[3];
+   char dbuffer[5];
 
    for (i = 1; i < RawSignal.Number + 1; i++)
    {
@@ -57,7 +59,7 @@ boolean Plugin_254(byte function, char *string)
       }
       else
       {
-         Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
+         Serial.print(PULSE_TO_US(RawSignal.Pulses[i]));
          if (i < RawSignal.Number)
             Serial.write(',');
       }
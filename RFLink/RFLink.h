@@ -31,6 +31,19 @@
 // #define CHECK_CACERT       // Send MQTT SSL CA Certificate
 #endif
 
+#ifdef ESP32
+// FreeRTOS pipeline, replaces loop()
+// #define RF_TASKS_ENABLED   // Capture, decode and output (MQTT/OLED) run as separate tasks
+#define CAPTURE_TASK_CORE 0   // Capture task shares the core with WiFi, it only drains buffered pulses
+#define DECODE_TASK_CORE 1    // Decode (plugins, serial) and output (MQTT, OLED) tasks
+#define CAPTURE_TASK_STACK 2048
+#define DECODE_TASK_STACK 8192
+#define OUTPUT_TASK_STACK 8192
+#define MSG_QUEUE_SIZE 8      // Decoded messages waiting for MQTT/OLED, e.g. while WiFi reconnects
+#define CMD_QUEUE_SIZE 2      // MQTT commands waiting for the decode task
+#define TASK_WAIT_MS 10       // Longest idle wait of the decode and output tasks
+#endif
+
 // Debug default
 #define RFDebug_0 false   // debug RF signals with plugin 001 (no decode)
 #define QRFDebug_0 false  // debug RF signals with plugin 001 but no multiplication (faster?, compact)
@@ -38,5 +51,14 @@
 #define QRFUDebug_0 false // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
 void CallReboot(void);
+void sendMsg();
+#if (defined(ESP32) || defined(ESP8266))
+void display_Heap_Stats();
+#endif
+#ifdef RF_TASKS_ENABLED
+void start_Tasks();
+void postCommand(const char *);
+void display_Task_Stats();
+#endif
 
 #endif
\ No newline at end of file
@@ -32,6 +32,18 @@
 //****************************************************************************************************************************************
 void sendMsg(); // See at bottom
 
+#if (defined(ESP32) || defined(ESP8266))
+static uint32_t PluginHeap = 0; // Heap taken by PluginInit() and PluginTXInit()
+#endif
+
+#ifdef RF_TASKS_ENABLED
+static TaskHandle_t DecodeTaskHandle = NULL;
+static TaskHandle_t OutputTaskHandle = NULL;
+static QueueHandle_t MsgQueue = NULL;   // Decoded messages, from the decode task to MQTT/OLED
+static QueueHandle_t CmdQueue = NULL;   // MQTT commands, from the output task to the decode task
+static unsigned long MsgDropped = 0;    // Messages lost because MsgQueue was full
+#endif
+
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
 void (*Reboot)(void) = 0; // reset function on adress 0.
 
@@ -93,8 +105,14 @@ void setup()
 #endif // MQTT_ENABLED
 #endif // ESP32 || ESP8266
 
+#if (defined(ESP32) || defined(ESP8266))
+  PluginHeap = ESP.getFreeHeap();
+#endif
   PluginInit();
   PluginTXInit();
+#if (defined(ESP32) || defined(ESP8266))
+  PluginHeap -= ESP.getFreeHeap();
+#endif
   set_Radio_mode(Radio_OFF);
 
 #if ((defined(ESP8266) || defined(ESP32)) && !defined(RFM69_ENABLED))
@@ -116,14 +134,20 @@ void setup()
   splash_OLED();
 #endif
 #ifdef MQTT_ENABLED
-  publishMsg();
+  publishMsg(pbuffer);
 #endif
   pbuffer[0] = 0;
   set_Radio_mode(Radio_RX);
+#ifdef RF_TASKS_ENABLED
+  start_Tasks();
+#endif
 }
 
 void loop()
 {
+#ifdef RF_TASKS_ENABLED
+  vTaskDelete(NULL); // The RF tasks do the work
+#else
 #ifdef MQTT_ENABLED
   checkMQTTloop();
   sendMsg();
@@ -137,6 +161,7 @@ void loop()
 #endif
   if (ScanEvent())
     sendMsg();
+#endif // RF_TASKS_ENABLED
 }
 
 void sendMsg()
@@ -146,14 +171,117 @@ void sendMsg()
 #ifdef SERIAL_ENABLED
     Serial.print(pbuffer);
 #endif
+#ifdef RF_TASKS_ENABLED
+#if (defined(MQTT_ENABLED) || defined(OLED_ENABLED))
+    if (xQueueSend(MsgQueue, pbuffer, 0) != pdTRUE)
+      MsgDropped++; // Output task is stuck, e.g. reconnecting WiFi
+#endif
+#else
 #ifdef MQTT_ENABLED
-    publishMsg();
+    publishMsg(pbuffer);
 #endif
 #ifdef OLED_ENABLED
-    print_OLED();
+    print_OLED(pbuffer);
 #endif
+#endif // RF_TASKS_ENABLED
     pbuffer[0] = 0;
   }
 }
 
+/*********************************************************************************************/
+
+#ifdef RF_TASKS_ENABLED
+// Decode task: what loop() does, with RF packets coming from the capture task
+static void DecodeTask(void *)
+{
+  char Cmd[INPUT_COMMAND_SIZE];
+
+  for (;;)
+  {
+    if (xQueueReceive(CmdQueue, Cmd, 0) == pdTRUE)
+    {
+      CheckMQTT((byte *)Cmd);
+      sendMsg();
+    }
+#ifdef SERIAL_ENABLED
+#if PIN_RF_TX_DATA_0 != NOT_A_PIN
+    if (CheckSerial())
+      sendMsg();
+#endif
+#endif
+    if (ScanEvent()) // Waits up to TASK_WAIT_MS for a packet
+      sendMsg();
+  }
+}
+
+// Output task: owns WiFi/MQTT and OLED, may block without holding up RF
+static void OutputTask(void *)
+{
+  char Msg[PRINT_BUFFER_SIZE];
+
+  for (;;)
+  {
+    if (xQueueReceive(MsgQueue, Msg, pdMS_TO_TICKS(TASK_WAIT_MS)) == pdTRUE)
+    {
+#ifdef MQTT_ENABLED
+      publishMsg(Msg);
+#endif
+#ifdef OLED_ENABLED
+      print_OLED(Msg);
+#endif
+    }
+#ifdef MQTT_ENABLED
+    checkMQTTloop();
+#endif
+  }
+}
+
+void start_Tasks()
+{
+  MsgQueue = xQueueCreate(MSG_QUEUE_SIZE, PRINT_BUFFER_SIZE);
+  CmdQueue = xQueueCreate(CMD_QUEUE_SIZE, INPUT_COMMAND_SIZE);
+  start_CaptureTask();
+  xTaskCreatePinnedToCore(DecodeTask, "RF_Decode", DECODE_TASK_STACK, NULL, 1, &DecodeTaskHandle, DECODE_TASK_CORE);
+  xTaskCreatePinnedToCore(OutputTask, "RF_Output", OUTPUT_TASK_STACK, NULL, 1, &OutputTaskHandle, DECODE_TASK_CORE);
+}
+
+void postCommand(const char *Cmd)
+{
+  char Buffer[INPUT_COMMAND_SIZE];
+
+  strncpy(Buffer, Cmd, INPUT_COMMAND_SIZE - 1);
+  Buffer[INPUT_COMMAND_SIZE - 1] = 0;
+  xQueueSend(CmdQueue, Buffer, 0);
+}
+
+// Free stack in bytes, queued packets and messages
+void display_Task_Stats()
+{
+  display_STAT(PSTR("CAPTURE"), uxTaskGetStackHighWaterMark(CaptureTaskHandle));
+  display_STAT(PSTR("DECODE"), uxTaskGetStackHighWaterMark(DecodeTaskHandle));
+  display_STAT(PSTR("OUTPUT"), uxTaskGetStackHighWaterMark(OutputTaskHandle));
+  display_STAT(PSTR("PACKETS"), RawSlotsQueued());
+  display_STAT(PSTR("MESSAGES"), uxQueueMessagesWaiting(MsgQueue));
+  display_STAT(PSTR("QUEUE_DROPPED"), MsgDropped);
+}
+#endif
+
+#if (defined(ESP32) || defined(ESP8266))
+// Free heap, largest free block, fragmentation in % and heap used by the plugins at boot
+void display_Heap_Stats()
+{
+  uint32_t Free = ESP.getFreeHeap();
+#ifdef ESP8266
+  uint32_t MaxBlock = ESP.getMaxFreeBlockSize();
+#else
+  uint32_t MaxBlock = ESP.getMaxAllocHeap();
+#endif
+
+  display_STAT(PSTR("HEAP"), Free);
+  display_STAT(PSTR("MAXBLOCK"), MaxBlock);
+  display_STAT(PSTR("FRAG"), Free ? 100 - (MaxBlock * 100) / Free : 0);
+  display_STAT(PSTR("PLUGINHEAP"), PluginHeap);
+}
+#endif
+
 /*********************************************************************************************/
\ No newline at end of file
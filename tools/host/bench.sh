@@ -0,0 +1,19 @@
+#!/bin/sh
+# Host benchmark tools/host/bench_<name>.cpp, built at -O2 and at -Os with the sketch (its main() replaces replay.cpp)
+# usage: tools/host/bench.sh <name> [compiler flags], e.g. bench.sh demod -DRAW_PULSE_16BIT
+# The figures are host nanoseconds: they rank two versions of a loop, they are not ESP32 or AVR cycles
+# Functions, loops and jump targets are aligned so that a change elsewhere in the tree does not move the figures by a few percent
+HOST=$(cd "$(dirname "$0")" && pwd)
+SRC=${SRC:-$HOST/../../RFLink}
+NAME=$1
+[ $# -gt 0 ] && shift
+OUT=$(mktemp -d)
+cp "$SRC/RFLink.ino" "$OUT/RFLink_ino.cpp"
+RESULT=0
+for O in -O2 -Os; do
+  echo "--- $O"
+  g++ -std=gnu++11 -w $O -falign-functions=64 -falign-loops=32 -falign-jumps=16 -DESP32 -I"$HOST/stubs" -I"$SRC" "$@" -o "$OUT/bench" \
+    "$OUT/RFLink_ino.cpp" "$SRC"/[1-9]_*.cpp "$HOST/stubs.cpp" "$HOST/bench_$NAME.cpp" && (cd "$HOST" && "$OUT/bench") || RESULT=1
+done
+rm -rf "$OUT"
+exit $RESULT
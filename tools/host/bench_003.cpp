@@ -0,0 +1,106 @@
+// Host benchmark of Plugin_003. Every packet of kaku.txt (see mkkaku.py) gets BENCH_COPIES copies with
+// +-10% jitter on each pulse, the plugin then decodes all of them in a loop. The time of the copies into
+// RawSignal alone is taken off. Run it on an older checkout as well to compare (before Plugin_003 moved to
+// API v2 that checkout needs its own bench_003.cpp):
+// usage: tools/host/bench.sh 003, SRC=<dir> tools/host/bench.sh 003 (figures of the host compiler)
+
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+#include <Arduino.h>
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+
+#define BENCH_COPIES 256
+#define BENCH_ROUNDS 15
+
+boolean Plugin_003(const PacketView &Packet, PluginOutput &Output);
+
+static unsigned long bench_seed = 12345;
+
+static unsigned int bench_random(unsigned int Range) // deterministic, the same samples on every run
+{
+  bench_seed = bench_seed * 1103515245UL + 12345UL;
+  return ((bench_seed >> 16) & 0x7FFF) % Range;
+}
+
+// Time of one round over Packets, with or without the plugin
+static double bench_round(const std::vector<RawSignalStruct> &Packets, bool Decode, unsigned long &Sink)
+{
+  const RepeatState Seen = {0, 0, 0, 0}; // no packet before
+  auto Start = std::chrono::steady_clock::now();
+
+  for (size_t n = 0; n < Packets.size(); n++)
+  {
+    memcpy(&RawSignal, &Packets[n], sizeof(RawSignalStruct));
+    pbuffer[0] = 0;
+    if (Decode)
+    {
+      PacketView Packet(RawSignal);
+      PluginOutput Output(pbuffer, PKSequenceNumber, 3, Seen);
+
+      Sink += Plugin_003(Packet, Output);
+    }
+    asm volatile("" ::: "memory");
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / Packets.size();
+}
+
+int main()
+{
+  std::vector<RawSignalStruct> Packets;
+  unsigned long Sink = 0;
+  char Line[4096];
+  FILE *f = fopen("kaku.txt", "r");
+
+  if (f == NULL)
+    return 1;
+  printf("%-6s %8s %8s\n", "sample", "copies", "decoded");
+  for (int Sample = 1; fgets(Line, sizeof(Line), f); Sample++)
+  {
+    std::vector<int> Pulses;
+    unsigned long Decoded = 0;
+
+    for (char *p = Line + 2; *p;)
+    {
+      Pulses.push_back(atoi(p));
+      while (*p && *p != ',')
+        p++;
+      if (*p)
+        p++;
+    }
+    for (int c = 0; c < BENCH_COPIES; c++)
+    {
+      RawSignal.Number = Pulses.size();
+      RawSignal.Pulses[0] = 0;
+      for (size_t x = 0; x < Pulses.size(); x++)
+        RawSignal.Pulses[x + 1] = PULSE_US(Pulses[x] * (90 + bench_random(21)) / 100);
+      ClusterSignal(RawSignal);
+      Packets.push_back(RawSignal);
+    }
+    std::vector<RawSignalStruct> Copies(Packets.end() - BENCH_COPIES, Packets.end());
+    bench_round(Copies, true, Decoded);
+    printf("%-6d %8d %8lu\n", Sample, BENCH_COPIES, Decoded);
+  }
+  fclose(f);
+  std::vector<RawSignalStruct> Mixed; // copy n of every sample, then copy n + 1: no run of the same packet
+  for (int c = 0; c < BENCH_COPIES; c++)
+    for (size_t n = c; n < Packets.size(); n += BENCH_COPIES)
+      Mixed.push_back(Packets[n]);
+
+  double Copy = 1e9, Total = 1e9;
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+  {
+    double Round = bench_round(Mixed, false, Sink);
+
+    if (Round < Copy)
+      Copy = Round;
+    Round = bench_round(Mixed, true, Sink);
+    if (Round < Total)
+      Total = Round;
+  }
+  printf("Plugin_003 %.1f ns per packet over %zu packets\n", Total - Copy, Packets.size());
+  return Sink == 1;
+}
@@ -0,0 +1,598 @@
+// Host benchmark of the PWM, PPM and Manchester primitives of 9_Demod against the loops of the plugins that
+// could use them. Every plugin gets 64 packets of random bits with +-10% jitter on each pulse, kept only when its
+// loop decodes them, and 64 copies of those with one pulse set to a random length (most of them rejected).
+// Both versions should give the same result on all of them, then each decodes the valid ones in a loop.
+// A plugin only moves to a primitive that is not slower than its loop at -O2 and at -Os.
+// usage: tools/host/bench.sh demod, the figures of the host compiler (not of an ESP32 or AVR)
+
+#include <chrono>
+#include <stdio.h>
+#include <Arduino.h>
+#include "5_Plugin.h"
+#include "9_Demod.h"
+
+#define BENCH_SAMPLES 64
+#define BENCH_LOOPS 2000000
+
+static unsigned long bench_seed = 12345;
+
+static unsigned int bench_random(unsigned int Range) // deterministic, the same samples on every run
+{
+  bench_seed = bench_seed * 1103515245UL + 12345UL;
+  return ((bench_seed >> 16) & 0x7FFF) % Range;
+}
+
+static RawPulse bench_pulse(unsigned int us) // us +-10%
+{
+  return PULSE_US(us * (90 + bench_random(21)) / 100);
+}
+
+// Pairs of pulses from Pulses[First], a long pulse at Pulses[First + Second] is a 1
+static void bench_pwm(RawSignalStruct &S, int Number, int First, int Bits, byte Second, unsigned int Short, unsigned int Long)
+{
+  S.Number = Number;
+  for (int x = 1; x <= Number; x++)
+    S.Pulses[x] = bench_pulse(Short);
+  for (int n = 0; n < Bits; n++)
+  {
+    byte Bit = bench_random(2);
+    S.Pulses[First + 2 * n + Second] = bench_pulse(Bit ? Long : Short);
+    S.Pulses[First + 2 * n + (Second ^ 1)] = bench_pulse(Bit ? Short : Long);
+  }
+}
+
+// Bit pulse Pulses[First + 2n] and a mark after it
+static void bench_ppm(RawSignalStruct &S, int Number, int First, int Bits, unsigned int Mark, unsigned int Short, unsigned int Long)
+{
+  S.Number = Number;
+  for (int x = 1; x <= Number; x++)
+    S.Pulses[x] = bench_pulse(Mark);
+  for (int n = 0; n < Bits; n++)
+    S.Pulses[First + 2 * n] = bench_pulse(bench_random(2) ? Long : Short);
+}
+
+// Manchester from Pulses[First], the bit before the first one a 1: a long pulse changes the bit, two short ones keep it
+static bool bench_manchester(RawSignalStruct &S, int Number, int First, unsigned long Header, int HeaderBits, int Bits, unsigned int Short, unsigned int Long)
+{
+  byte Last = 1;
+  int x = First;
+
+  S.Number = Number;
+  for (int n = 0; n < Bits; n++)
+  {
+    byte Bit = (n < HeaderBits) ? (Header >> (HeaderBits - 1 - n)) & 1 : bench_random(2);
+    if (x + 1 > Number)
+      return false;
+    if (Bit != Last)
+      S.Pulses[x++] = bench_pulse(Long);
+    else
+    {
+      S.Pulses[x++] = bench_pulse(Short);
+      S.Pulses[x++] = bench_pulse(Short);
+    }
+    Last = Bit;
+  }
+  for (; x <= Number; x++)
+    S.Pulses[x] = bench_pulse(Short);
+  return true;
+}
+
+// Biphase from Pulses[1], a long pulse is a 0 and two short ones a 1, then a short closing pulse.
+// Number is the pulse count it took, false past MaxNumber
+static bool bench_biphase(RawSignalStruct &S, int MaxNumber, unsigned long Header, int HeaderBits, int Bits, unsigned int Short, unsigned int Long, unsigned int Close)
+{
+  int x = 1;
+
+  for (int n = 0; n < Bits; n++)
+  {
+    byte Bit = (n < HeaderBits) ? (Header >> (HeaderBits - 1 - n)) & 1 : bench_random(2);
+    if (x + 2 > MaxNumber)
+      return false;
+    if (Bit)
+    {
+      S.Pulses[x++] = bench_pulse(Short);
+      S.Pulses[x++] = bench_pulse(Short);
+    }
+    else
+      S.Pulses[x++] = bench_pulse(Long);
+  }
+  S.Pulses[x] = bench_pulse(Close);
+  S.Number = x;
+  return true;
+}
+
+/*********************************************************************************************\
+ * Plugin_005 Eurodomest, PWM, the second pulse of a pair carries the bit
+\*********************************************************************************************/
+#define EURODOMEST_PulseLength 50
+#define EURODOMEST_PULSEMID PULSE_US(400)
+#define EURODOMEST_PULSEMIN PULSE_US(100)
+#define EURODOMEST_PULSEMAX PULSE_US(900)
+const DemodTiming Plugin_005_Timing = {EURODOMEST_PULSEMID, EURODOMEST_PULSEMIN, 0, EURODOMEST_PULSEMAX, 0};
+
+static void make_005(RawSignalStruct &S) { bench_pwm(S, 50, 1, 24, 1, 250, 750); }
+
+__attribute__((noinline)) static bool loop_005(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 0;
+
+  for (int x = 2; x < EURODOMEST_PulseLength; x += 2)
+  {
+    bitstream <<= 1; //Always shift
+    if (Packet.Pulses[x] > EURODOMEST_PULSEMID)
+    { // long pulse
+      if (Packet.Pulses[x - 1] > EURODOMEST_PULSEMID)
+        return false; // not a 01 or 10 transmission
+      if (Packet.Pulses[x] > EURODOMEST_PULSEMAX)
+        return false; // make sure the long pulse is within range
+      bitstream |= 0x1;
+    }
+    else
+    { // short pulse
+      if (Packet.Pulses[x] < EURODOMEST_PULSEMIN)
+        return false; // pulse too short to be Eurodomest
+      if (Packet.Pulses[x - 1] < EURODOMEST_PULSEMID)
+        return false; // not a 01 or 10 transmission
+    }
+  }
+  Value = bitstream;
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_005(const PacketView &Packet, unsigned long &Value)
+{
+  return Demod_PWM(Packet, 1, 24, Plugin_005_Timing, DEMOD_SECOND, Value);
+}
+
+/*********************************************************************************************\
+ * Plugin_065 GARAGE640, PWM, the first pulse of a pair carries the bit
+\*********************************************************************************************/
+#define GARAGE640_PULSECOUNT 48
+#define GARAGE640_PULSEMID (PULSE_US(320))
+#define GARAGE640_PULSEMAX (PULSE_US(540))
+#define GARAGE640_PULSEMIN (PULSE_US(60))
+const DemodTiming Plugin_065_Timing = {GARAGE640_PULSEMID, GARAGE640_PULSEMIN, 0, GARAGE640_PULSEMAX, 0};
+
+static void make_065(RawSignalStruct &S) { bench_pwm(S, 50, 1, 24, 0, 160, 480); }
+
+__attribute__((noinline)) static bool loop_065(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 0L;
+
+  for (byte x = 1; x < GARAGE640_PULSECOUNT; x += 2)
+  {
+    if (Packet.Pulses[x] > GARAGE640_PULSEMID)
+    {
+      if (Packet.Pulses[x] > GARAGE640_PULSEMAX)
+        return false; // pulse too long
+      if (Packet.Pulses[x + 1] > GARAGE640_PULSEMID)
+        return false; // invalid pulse sequence 10/01
+      if (Packet.Pulses[x + 1] < GARAGE640_PULSEMIN)
+        return false; // pulse too short
+      bitstream = (bitstream << 1) | 0x1;
+    }
+    else
+    {
+      if (Packet.Pulses[x] < GARAGE640_PULSEMIN)
+        return false; // pulse too short
+      if (Packet.Pulses[x + 1] < GARAGE640_PULSEMID)
+        return false; // invalid pulse sequence 10/01
+      bitstream = bitstream << 1;
+    }
+  }
+  Value = bitstream;
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_065(const PacketView &Packet, unsigned long &Value)
+{
+  return Demod_PWM(Packet, 1, 24, Plugin_065_Timing, 0, Value);
+}
+
+/*********************************************************************************************\
+ * Plugin_070 SelectPlus, PWM, a pulse of SELECTPLUS_PULSEMID is long
+\*********************************************************************************************/
+#define SELECTPLUS_PULSECOUNT 36
+#define SELECTPLUS_PULSEMID PULSE_US(650)
+#define SELECTPLUS_PULSEMAX PULSE_US(2125)
+const DemodTiming Plugin_070_Timing = {SELECTPLUS_PULSEMID - 1, 0, SELECTPLUS_PULSEMID, SELECTPLUS_PULSEMAX, 0};
+
+static void make_070(RawSignalStruct &S) { bench_pwm(S, 36, 2, 17, 0, 300, 950); }
+
+__attribute__((noinline)) static bool loop_070(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 0L;
+
+  for (byte x = 2; x < SELECTPLUS_PULSECOUNT; x = x + 2)
+  {
+    bitstream <<= 1; // Always shift
+    if (Packet.Pulses[x] < SELECTPLUS_PULSEMID)
+    {
+      if (Packet.Pulses[x + 1] < SELECTPLUS_PULSEMID)
+        return false; // invalid pulse sequence 10/01
+    }
+    else
+    {
+      if (Packet.Pulses[x] > SELECTPLUS_PULSEMAX)
+        return false; // invalid pulse duration, pulse too long
+      if (Packet.Pulses[x + 1] > SELECTPLUS_PULSEMID)
+        return false; // invalid pulse sequence 10/01
+      bitstream |= 0x1;
+    }
+  }
+  Value = bitstream;
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_070(const PacketView &Packet, unsigned long &Value)
+{
+  return Demod_PWM(Packet, 2, 17, Plugin_070_Timing, 0, Value);
+}
+
+/*********************************************************************************************\
+ * Plugin_037 AcuRite 986, PPM, 32 bits and 8 CRC bits, the marks not checked
+\*********************************************************************************************/
+#define ACURITE_MIDHI PULSE_US(2000)
+#define ACURITE_PULSEMAXMIN PULSE_US(650)
+const DemodTiming Plugin_037_Timing = {ACURITE_PULSEMAXMIN, 0, 0, ACURITE_MIDHI, 0};
+const DemodTiming Plugin_037_CRCTiming = {ACURITE_PULSEMAXMIN, 0, 0, 0, 0};
+
+static void make_037(RawSignalStruct &S) { bench_ppm(S, 84, 2, 40, 500, 450, 1000); }
+
+__attribute__((noinline)) static bool loop_037(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 0L;
+  byte bitstream2 = 0;
+
+  for (byte x = 0; x < 64; x += 2)
+  {
+    if (Packet.Pulses[x + 2] > ACURITE_MIDHI)
+      return false; // in between pulses should be short
+    bitstream <<= 1;
+    if (Packet.Pulses[x + 2] > ACURITE_PULSEMAXMIN)
+      bitstream |= 0x1;
+  }
+  for (byte x = 64; x < 80; x = x + 2)
+  {
+    bitstream2 <<= 1;
+    if (Packet.Pulses[x + 2] > ACURITE_PULSEMAXMIN)
+      bitstream2 |= 0x1;
+  }
+  Value = bitstream ^ bitstream2;
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_037(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 0L, bitstream2 = 0L;
+
+  int x = Demod_PPM(Packet, 2, 32, Plugin_037_Timing, 0, bitstream);
+  if (!x)
+    return false;
+  Demod_PPM(Packet, x, 8, Plugin_037_CRCTiming, 0, bitstream2);
+  Value = bitstream ^ bitstream2;
+  return true;
+}
+
+/*********************************************************************************************\
+ * Plugin_046 Auriol V2, PPM with a short window and checked marks, 24 + 12 bits
+\*********************************************************************************************/
+#define AURIOLV2_PULSECOUNT 74
+#define AURIOLV2_MIDHI PULSE_US(700)
+#define AURIOLV2_PULSEMIN PULSE_US(500)
+#define AURIOLV2_PULSEMINMAX PULSE_US(1100)
+#define AURIOLV2_PULSEMAXMIN PULSE_US(1400)
+#define AURIOLV2_PULSEMAX PULSE_US(2100)
+const DemodTiming Plugin_046_Timing = {AURIOLV2_PULSEMAXMIN, AURIOLV2_PULSEMIN, AURIOLV2_PULSEMINMAX, AURIOLV2_PULSEMAX, AURIOLV2_MIDHI};
+
+static void make_046(RawSignalStruct &S) { bench_ppm(S, 74, 2, 36, 480, 800, 1750); }
+
+__attribute__((noinline)) static bool loop_046(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream1 = 0L;
+  unsigned long bitstream2 = 0L;
+  byte bitcounter = 0;
+
+  for (byte x = 2; x < (AURIOLV2_PULSECOUNT); x += 2)
+  {
+    if (Packet.Pulses[x + 1] > AURIOLV2_MIDHI)
+      return false; // in between pulses should not be more than 700 µs
+    if (Packet.Pulses[x] > AURIOLV2_PULSEMAXMIN)
+    {
+      if (Packet.Pulses[x] > AURIOLV2_PULSEMAX)
+        return false;
+      if (bitcounter < 24)
+      {
+        bitstream1 <<= 1;
+        bitstream1 |= 0x1;
+        bitcounter++; // only need to count the first 24 bits
+      }
+      else
+      {
+        bitstream2 <<= 1;
+        bitstream2 |= 0x1;
+      }
+    }
+    else
+    {
+      if (Packet.Pulses[x] > AURIOLV2_PULSEMINMAX)
+        return false;
+      if (Packet.Pulses[x] < AURIOLV2_PULSEMIN)
+        return false;
+      if (bitcounter < 24)
+      {
+        bitstream1 <<= 1;
+        bitcounter++; // only need to count the first 24 bits
+      }
+      else
+        bitstream2 <<= 1;
+    }
+  }
+  Value = bitstream1 ^ (bitstream2 << 8);
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_046(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream1 = 0L, bitstream2 = 0L;
+
+  int x = Demod_PPM(Packet, 2, 24, Plugin_046_Timing, 0, bitstream1);
+  if (!x || !Demod_PPM(Packet, x, 12, Plugin_046_Timing, 0, bitstream2))
+    return false;
+  Value = bitstream1 ^ (bitstream2 << 8);
+  return true;
+}
+
+/*********************************************************************************************\
+ * Plugin_036 F007_TH, Manchester, a header of 18 bits then 33 data bits. The loop takes a pulse of
+ * F007_TH_PULSE_MID as long when it opens a bit but as short when it closes a pair, see ShortMax
+\*********************************************************************************************/
+#define F007_TH_PULSECOUNT 111
+#define F007_TH_PULSE_MID PULSE_US(650)
+const DemodTiming Plugin_036_Timing = {F007_TH_PULSE_MID - 1, 0, F007_TH_PULSE_MID, 0, 0};
+
+static void make_036(RawSignalStruct &S)
+{
+  while (!bench_manchester(S, F007_TH_PULSECOUNT, 2, 0x3FEA2, 18, 51, 480, 980))
+    ;
+}
+
+__attribute__((noinline)) static bool loop_036(const PacketView &Packet, unsigned long &Value)
+{
+  byte toggle = 1;
+  byte pulsecounter = 2;
+  int bitcounter = 0;
+  unsigned long headerstream = 0L;
+  unsigned long datastream = 0L;
+
+  while (bitcounter < 51)
+  {
+    bitcounter++;
+    if (Packet.Pulses[pulsecounter] < F007_TH_PULSE_MID)
+    { // Short pulse in second half-bit -> same value
+      if (Packet.Pulses[pulsecounter + 1] > F007_TH_PULSE_MID)
+        return false; // Invalid Manchester code
+      pulsecounter += 2;
+    }
+    else
+    { // Long pulse in second half-bit -> invert bit value
+      toggle ^= 0x1;
+      pulsecounter += 1;
+    }
+    if ((bitcounter <= 9 || bitcounter == 11) && toggle == 0)
+      return false; // Invalid 0 in header
+    if (bitcounter == 19)
+    {
+      if (headerstream != 0x3FEA2)
+        return false; // Invalid header
+    }
+    if (bitcounter < 19)
+    {
+      headerstream <<= 1;
+      headerstream |= toggle;
+    }
+    else
+    {
+      datastream <<= 1;
+      datastream |= toggle;
+    }
+  }
+  Value = datastream & 0xFFFFFFFF;
+  return true;
+}
+
+__attribute__((noinline)) static bool demod_036(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream = 1L; // the bit before the header is a 1
+
+  int x = Demod_Manchester(Packet, 2, 18, Plugin_036_Timing, bitstream);
+  if (!x || (bitstream & 0x3FFFF) != 0x3FEA2)
+    return false;
+  if (!Demod_Manchester(Packet, x, 33, Plugin_036_Timing, bitstream))
+    return false;
+  Value = bitstream & 0xFFFFFFFF;
+  return true;
+}
+
+/*********************************************************************************************\
+ * Plugin_042 UPM/Esic, biphase of 36 bits, the short and long pulses in their windows
+\*********************************************************************************************/
+#define UPM_MIN_PULSECOUNT 46
+#define UPM_MAX_PULSECOUNT 56
+#define UPM_PULSELOHI PULSE_US(1100)
+#define UPM_PULSEHIHI PULSE_US(2075)
+#define UPM_PULSEHILO PULSE_US(1600)
+const DemodTiming Plugin_042_Timing = {UPM_PULSEHILO, 0, UPM_PULSELOHI, UPM_PULSEHIHI - 1, 0};
+
+static void make_042(RawSignalStruct &S)
+{
+  while (!bench_biphase(S, UPM_MAX_PULSECOUNT, 0x0C, 4, 36, 900, 1850, 400) || S.Number < UPM_MIN_PULSECOUNT)
+    ;
+}
+
+static bool value_042(byte bitcounter, unsigned long bitstream1, unsigned long bitstream2, unsigned long &Value)
+{
+  Value = (bitstream1 << 20) ^ bitstream2 ^ bitcounter;
+  return true;
+}
+
+__attribute__((noinline)) static bool loop_042(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream1 = 0L; // holds first 10 bits
+  unsigned long bitstream2 = 0L; // holds last 26 bits
+  byte bitcounter = 0;           // counts number of received bits (converted from pulses)
+  byte halfbit = 0;              // high pulse = 1, 2 low pulses = 0, halfbit keeps track of low pulses
+
+  for (byte x = 1; x < Packet.Number; x++)
+  {
+    if ((Packet.Pulses[x] > UPM_PULSEHILO) && (Packet.Pulses[x] < UPM_PULSEHIHI))
+    {
+      if (halfbit == 1) // UPM cant receive a 1 bit after a single low value
+        return false;   // pulse error, must not be a UPM packet or reception error
+
+      if (bitcounter < 10)
+      {
+        bitstream1 <<= 1;
+        bitcounter++; // only need to count the first 10 bits
+      }
+      else
+        bitstream2 <<= 1;
+
+      halfbit = 0; // wait for next first low or high pulse
+    }
+    else
+    {
+      if ((Packet.Pulses[x] > UPM_PULSELOHI))
+        return false; // Not a valid UPM pulse length
+
+      if (halfbit == 0) // 2 times a low value = 0 bit
+        halfbit = 1;    // first half received
+      else
+      {
+        if (bitcounter < 10)
+        {
+          bitstream1 <<= 1;
+          bitstream1 |= 0x1;
+          bitcounter++; // only need to count the first 10 bits
+        }
+        else
+        {
+          bitstream2 <<= 1;
+          bitstream2 |= 0x1;
+        }
+        halfbit = 0; // wait for next first low or high pulse
+      }
+    }
+  }
+  return value_042(bitcounter, bitstream1, bitstream2, Value);
+}
+
+static bool bits_042(const DemodBits &bits, unsigned long &Value)
+{
+  byte bitcounter = bits.Count;
+  unsigned long bitstream1 = bits.Get(0, bitcounter < 10 ? bitcounter : 10);
+  unsigned long bitstream2 = 0L;
+
+  if (bitcounter > 10)
+    bitstream2 = bits.Get(bitcounter > 42 ? bitcounter - 32 : 10, bitcounter > 42 ? 32 : bitcounter - 10); // last 32 bits at most
+  return value_042(bitcounter < 10 ? bitcounter : 10, bitstream1, bitstream2, Value);
+}
+
+__attribute__((noinline)) static bool demod_042(const PacketView &Packet, unsigned long &Value)
+{
+  unsigned long bitstream1 = 0L, bitstream2 = 0L;
+
+  int x = Demod_Biphase(Packet, 1, Packet.Number - 1, Plugin_042_Timing, 0, 10, bitstream1);
+  if (!x || !Demod_Biphase(Packet, x, Packet.Number - 1, Plugin_042_Timing, 0, 0xFF, bitstream2))
+    return false;
+  return value_042(10, bitstream1, bitstream2, Value);
+}
+
+// As Plugin_034: the long pulses are the clusters above UPM_PULSEHILO, the windows are not checked
+__attribute__((noinline)) static bool symbols_042(const PacketView &Packet, unsigned long &Value)
+{
+  DemodBits bits;
+  byte L = Packet.SymbolAbove(UPM_PULSEHILO);
+
+  if (L == 0 || L >= Packet.Clusters)
+    return false;
+  if (!Demod_BiphaseSymbols(Packet, 1, Packet.Number - 1, L, 0, DEMOD_BITS_MAX, bits))
+    return false;
+  return bits_042(bits, Value);
+}
+
+/*********************************************************************************************\
+ * Driver
+\*********************************************************************************************/
+typedef bool (*BenchDecode)(const PacketView &, unsigned long &);
+
+struct BenchCase
+{
+  const char *Name;
+  void (*Make)(RawSignalStruct &);
+  BenchDecode Loop;  // the plugin
+  BenchDecode Demod; // the same with the primitive
+};
+
+static const BenchCase bench_cases[] = {
+    {"005 Eurodomest  PWM", make_005, loop_005, demod_005},
+    {"065 GARAGE640   PWM", make_065, loop_065, demod_065},
+    {"070 SelectPlus  PWM", make_070, loop_070, demod_070},
+    {"037 AcuRite     PPM", make_037, loop_037, demod_037},
+    {"046 Auriol V2   PPM", make_046, loop_046, demod_046},
+    {"036 F007_TH     Manchester", make_036, loop_036, demod_036},
+    {"042 UPM/Esic    Biphase", make_042, loop_042, demod_042},
+    {"042 UPM/Esic    BiphaseSymbols", make_042, loop_042, symbols_042},
+};
+
+static RawSignalStruct bench_valid[BENCH_SAMPLES];
+static RawSignalStruct bench_broken[BENCH_SAMPLES];
+
+static double bench_time(BenchDecode Decode, unsigned long &Sink)
+{
+  auto Start = std::chrono::steady_clock::now();
+  for (long i = 0; i < BENCH_LOOPS; i++)
+  {
+    PacketView Packet(bench_valid[i & (BENCH_SAMPLES - 1)]);
+    unsigned long Value = 0;
+    Sink += Decode(Packet, Value) + Value;
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / BENCH_LOOPS;
+}
+
+int main()
+{
+  unsigned long Sink = 0;
+
+  printf("%-32s %8s %8s %8s %9s\n", "plugin", "loop ns", "demod ns", "ratio", "mismatch");
+  for (const BenchCase &Case : bench_cases)
+  {
+    int Mismatch = 0;
+
+    for (int n = 0; n < BENCH_SAMPLES; n++)
+    {
+      unsigned long Value;
+      do
+        Case.Make(bench_valid[n]);
+      while (!Case.Loop(PacketView(bench_valid[n]), Value));
+      ClusterSignal(bench_valid[n]);
+
+      bench_broken[n] = bench_valid[n];
+      bench_broken[n].Pulses[1 + bench_random(bench_broken[n].Number)] = PULSE_US(bench_random(3000));
+      ClusterSignal(bench_broken[n]);
+    }
+    for (int n = 0; n < 2 * BENCH_SAMPLES; n++)
+    {
+      PacketView Packet((n < BENCH_SAMPLES) ? bench_valid[n] : bench_broken[n - BENCH_SAMPLES]);
+      unsigned long LoopValue = 0, DemodValue = 0;
+      bool LoopOk = Case.Loop(Packet, LoopValue), DemodOk = Case.Demod(Packet, DemodValue);
+      if (LoopOk != DemodOk || (LoopOk && LoopValue != DemodValue))
+        Mismatch++;
+    }
+
+    double Loop = bench_time(Case.Loop, Sink);
+    double Demod = bench_time(Case.Demod, Sink);
+    printf("%-32s %8.1f %8.1f %8.2f %9d\n", Case.Name, Loop, Demod, Demod / Loop, Mismatch);
+  }
+  return Sink == 1;
+}
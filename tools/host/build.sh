@@ -0,0 +1,21 @@
+#!/bin/sh
+# Host build of the sketch for replay.cpp
+# usage: tools/host/build.sh [out] [compiler flags], e.g. build.sh rflink_16 -DRAW_PULSE_16BIT
+# SRC=<dir> builds another RFLink source directory (a checkout of an older commit) against the same stubs
+# OFF="FLAG ..." comments out those #define flags of the headers first, e.g. OFF=PLUGIN_PULSE_INDEX
+HOST=$(cd "$(dirname "$0")" && pwd)
+SRC=${SRC:-$HOST/../../RFLink}
+OUT=${1:-rflink}
+[ $# -gt 0 ] && shift
+if [ -n "$OFF" ]; then
+  COPY=$(mktemp -d)
+  cp -r "$SRC/." "$COPY"
+  for f in $OFF; do sed -i "s|^#define $f\b|// #define $f|" "$COPY"/*.h; done
+  SRC=$COPY
+fi
+cp "$SRC/RFLink.ino" "$HOST/RFLink_ino.cpp"
+g++ -std=gnu++11 -w -O2 -DESP32 -I"$HOST/stubs" -I"$SRC" "$@" -o "$OUT" \
+  "$HOST/RFLink_ino.cpp" "$SRC"/[1-9]_*.cpp "$HOST/stubs.cpp" "$HOST/replay.cpp"
+RESULT=$?
+[ -n "$COPY" ] && rm -rf "$COPY"
+exit $RESULT
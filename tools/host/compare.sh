@@ -0,0 +1,16 @@
+#!/bin/sh
+# Decodes of an older commit against the working tree, for every replay file given
+# usage: tools/host/compare.sh <commit> <file>... -> the lines that differ, nothing when they agree
+HOST=$(cd "$(dirname "$0")" && pwd)
+REV=$1
+shift
+WORK=$(mktemp -d)
+git -C "$HOST/../.." archive "$REV" RFLink | tar -x -C "$WORK"
+(cd "$WORK" && SRC="$WORK/RFLink" "$HOST/build.sh" rflink_old && "$HOST/build.sh" rflink_new) || { rm -rf "$WORK"; exit 1; }
+for f in "$@"; do
+  f=$(cd "$(dirname "$f")" && pwd)/$(basename "$f")
+  (cd "$WORK" && rm -f nvs.bin && ./rflink_old < "$f" | grep -v "Compiled on\|Sketch File" > old.txt)
+  (cd "$WORK" && rm -f nvs.bin && ./rflink_new < "$f" | grep -v "Compiled on\|Sketch File" > new.txt)
+  diff "$WORK/old.txt" "$WORK/new.txt" | grep '^[<>]' | sed "s|^|$(basename "$f"): |"
+done
+rm -rf "$WORK"
@@ -0,0 +1,20 @@
+# Sample packets from the "Pulses=n; Pulses(uSec)=..." lines in the plugin comments, one R line each
+import glob, os, re
+
+here = os.path.dirname(os.path.abspath(__file__))
+out = []
+for f in sorted(glob.glob(os.path.join(here, '../../RFLink/Plugins/Plugin_*.c'))):
+    for line in open(f, errors='ignore'):
+        m = re.search(r'Pulses=(\d+);\s*Pulses\(uSec\)=\s*([0-9, ]+)', line)
+        if not m:
+            continue
+        n = int(m.group(1))
+        vals = [v for v in m.group(2).replace(' ', '').split(',') if v]
+        if n > 292 or len(vals) < 10:
+            continue
+        vals = vals[:n]
+        while len(vals) < n:
+            vals.append('5000')
+        out.append('R ' + ','.join(vals))
+open(os.path.join(here, 'corpus.txt'), 'w').write('\n'.join(out) + '\n')
+print(len(out))
@@ -0,0 +1,34 @@
+# Plugin_003 samples for bench_003.cpp: the debug lines of the plugin header, then one packet for each
+# device of its timing table, built from the shortest and longest pulse (32 uSec units) the table gives
+# usage: python3 mkkaku.py > kaku.txt
+import os, re
+
+PATTERN = {'0': '0101', 'f': '0110', '1': '1010'}
+
+# device, shortest and longest pulse, 12 symbols (first sent first)
+DEVICES = [
+    ('Intertechno ITK200', 8, 43, 'fff0f0000000'),
+    ('Profile PN-47N', 5, 26, '000f000f0ff0'),
+    ('Elro AB-600MA', 7, 29, 'ff0f0fff0fff'),
+    ('Profile PN-44N', 9, 34, '000f000f0ff0'),
+    ('ProMax RSL366T', 11, 41, 'f0fff0ffffff'),
+    ('Flamingo FA500R', 8, 30, '0000f0000ff0'),
+    ('Perel', 8, 33, 'f0fff0f0ff0f'),
+    ('Elro Home Easy', 8, 30, 'ffff0ff0fff0'),
+    ('AB400R', 8, 30, 'f0fff0ffff0f'),
+    ('Sartano', 11, 34, '00000f0000f0'),
+    ('ProFile', 9, 34, '0000f0000ff0'),
+    ('Everflourish EMW203', 14, 55, '0f11f1f11f1f'),
+    ('Select Remote / Blokker', 3, 22, '0000000100f0'),
+    ('PT2262', 9, 34, 'f00010001010'),
+    ('Tristate', 9, 34, '0f1001f01f10')]
+
+if __name__ == '__main__':
+    here = os.path.dirname(os.path.abspath(__file__))
+    source = open(os.path.join(here, '../../RFLink/Plugins/Plugin_003.c')).read()
+    for m in re.finditer(r'DEBUG;Pulses=50;Pulses\(uSec\)=([0-9,]+);', source):
+        print('R ' + m.group(1))
+    for name, low, high, symbols in DEVICES:
+        bits = ''.join(PATTERN[s] for s in symbols)
+        pulses = [high * 32 + 16 if b == '1' else low * 32 + 16 for b in bits]
+        print('R ' + ','.join(map(str, pulses + [low * 32 + 16, 7000])))
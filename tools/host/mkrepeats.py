@@ -0,0 +1,14 @@
+# Each corpus packet sent 4 times in a burst as edges, every pulse moved by up to +/-J uSec
+# usage: python3 mkrepeats.py J > repeats.txt, then count the decodes and REPEATS of 10;STATS;
+import os, random, sys
+
+here = os.path.dirname(os.path.abspath(__file__))
+random.seed(10)
+J = int(sys.argv[1]) if len(sys.argv) > 1 else 0
+for line in open(os.path.join(here, 'corpus.txt')):
+    pulses = [int(x) for x in line.split()[1].split(',')][:-1]
+    burst = []
+    for copy in range(4):
+        burst += [max(30, x + random.randint(-J, J)) for x in pulses] + [6000]
+    print('P ' + ','.join(map(str, burst)))
+print('S 10;STATS;')
@@ -0,0 +1,18 @@
+# Clock skew and jitter set: every corpus packet unscaled, then with all pulses but the end gap scaled by
+# each of FACTORS, then JITTER copies with every pulse moved by up to +/-25%. skewrate.py reads it back
+# usage: python3 mkskew.py > skew.txt
+import os, random
+
+FACTORS = [0.55, 0.6, 0.65, 0.7, 0.75, 0.8, 0.9, 1.1, 1.2, 1.3, 1.4, 1.5]
+JITTER = 30
+
+if __name__ == '__main__':
+    here = os.path.dirname(os.path.abspath(__file__))
+    random.seed(23)
+    for line in open(os.path.join(here, 'corpus.txt')):
+        pulses = [int(x) for x in line.split()[1].split(',')]
+        print('R ' + ','.join(map(str, pulses)))
+        for f in FACTORS:
+            print('R ' + ','.join([str(max(1, int(x * f))) for x in pulses[:-1]] + [str(pulses[-1])]))
+        for copy in range(JITTER):
+            print('R ' + ','.join([str(max(1, int(x * random.uniform(0.75, 1.25)))) for x in pulses[:-1]] + [str(pulses[-1])]))
@@ -0,0 +1,35 @@
+# Replay regression check: the decode of every R line of the files by two builds, packet by packet.
+# A packet the old build decoded that the new one reports as something else fails the check, packets lost
+# (now NODECODE) or gained are listed. With -exact every difference fails, e.g. a build with and without a
+# filter that may only save work.
+# The copies of skew.txt (mkskew.py) are checked against the unscaled packet of their block instead: a copy
+# that now decodes as its reference is fixed, one that now decodes as anything else fails, gained or changed
+# usage: python3 regress.py [-exact] <old binary> <new binary> <file>..., exit code 1 on a failure
+import os, sys
+
+from skewrate import block, decodes
+
+args = sys.argv[1:]
+exact = args[:1] == ['-exact']
+if exact:
+    args = args[1:]
+old, new, files = os.path.abspath(args[0]), os.path.abspath(args[1]), args[2:]
+
+failed = False
+for name in files:
+    text = open(name).read()
+    skew = os.path.basename(name) == 'skew.txt'
+    before, after = decodes(old, text), decodes(new, text)
+    for n, (a, b) in enumerate(zip(before, after)):
+        if a == b:
+            continue
+        ref = before[n - n % block] if skew and n % block else None
+        if ref and b and b == ref:
+            kind = 'fixed'
+        elif ref and b:
+            kind = 'misdecoded'
+        else:
+            kind = 'changed' if a and b else 'lost' if a else 'gained'
+        print('%s packet %d %s: %s -> %s' % (os.path.basename(name), n, kind, a or 'NODECODE', b or 'NODECODE'))
+        failed |= kind in ('changed', 'misdecoded') or exact
+sys.exit(1 if failed else 0)
@@ -0,0 +1,108 @@
+// Host replay of recorded packets through the sketch. One command per line on stdin:
+//   R a,b,c,...  pulse lengths in uSec straight into RawSignal, then PluginRXCall()
+//                The decode (or NODECODE) follows a line with a single #
+//   P a,b,c,...  the same pulses as edges on the receiver pin, first a mark, through loop()
+//   G ms         gap before the next R line (default 3000 ms)
+//   S text       text on the serial port, e.g. S 10;STATS;
+
+#include <vector>
+#include <Arduino.h>
+
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+
+extern unsigned long sim_us;
+extern int sim_level;
+extern void (*sim_isr)(void);
+extern std::string sim_serial_in;
+void sim_rmt_edge();
+
+void setup();
+void loop();
+
+static unsigned long sim_gap = 3000000;
+
+static std::vector<int> parse_pulses(const char *p)
+{
+  std::vector<int> Pulses;
+  while (*p)
+  {
+    Pulses.push_back(atoi(p));
+    while (*p && *p != ',')
+      p++;
+    if (*p)
+      p++;
+  }
+  return Pulses;
+}
+
+static void replay(const char *List)
+{
+  std::vector<int> Pulses = parse_pulses(List);
+
+  RawSignal.Number = Pulses.size();
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  RawSignal.Pulses[0] = 0;
+  for (size_t i = 0; i < Pulses.size(); i++)
+    RawSignal.Pulses[i + 1] = PULSE_US(Pulses[i]);
+  sim_us += sim_gap;
+  RawSignal.Time = millis();
+  ClusterSignal(RawSignal);
+  pbuffer[0] = 0;
+  bool Decoded = PluginRXCall(0, 0);
+  printf("#\n%s", Decoded ? pbuffer : "NODECODE\n");
+}
+
+static void edges(const char *List)
+{
+  std::vector<int> Pulses = parse_pulses(List);
+
+  // The line idles low, pulses alternate mark and space starting with a mark
+  sim_us += 3000000;
+  for (int k = 0; k < 3; k++)
+    loop();
+  sim_level = 1;
+  if (sim_isr)
+    sim_isr();
+  sim_rmt_edge();
+  for (size_t i = 0; i + 1 < Pulses.size(); i++)
+  {
+    sim_us += Pulses[i];
+    sim_level = !sim_level;
+    if (sim_isr)
+      sim_isr();
+    sim_rmt_edge();
+  }
+  for (int k = 0; k < 20; k++)
+  { // The plugins take their time, the line went quiet long enough to close the frame
+    sim_us += 1000;
+    loop();
+  }
+  sim_level = 0;
+}
+
+int main()
+{
+  setup();
+  printf("--- setup done\n");
+
+  char line[8192];
+  while (fgets(line, sizeof(line), stdin))
+  {
+    line[strcspn(line, "\r\n")] = 0;
+    if (!strncmp(line, "R ", 2))
+      replay(line + 2);
+    else if (!strncmp(line, "P ", 2))
+      edges(line + 2);
+    else if (!strncmp(line, "G ", 2))
+      sim_gap = atol(line + 2) * 1000UL;
+    else if (!strncmp(line, "S ", 2))
+    {
+      sim_serial_in = std::string(line + 2) + "\n";
+      loop();
+    }
+  }
+  return 0;
+}
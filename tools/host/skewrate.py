@@ -0,0 +1,41 @@
+# Decode rates of skew.txt (mkskew.py) per protocol: how many scaled or jittered copies of each packet
+# decode as the unscaled one, and how many decode as something else
+# usage: python3 skewrate.py <binary>..., e.g. the builds of build.sh before and after a timing change
+import os, subprocess, sys
+from mkskew import FACTORS, JITTER
+
+here = os.path.dirname(os.path.abspath(__file__))
+block = 1 + len(FACTORS) + JITTER
+skew = open(os.path.join(here, 'skew.txt')).read()
+
+def decodes(binary, text=skew):
+    out = subprocess.run([binary], input=text.encode(), capture_output=True).stdout.decode(errors='ignore')
+    result = []
+    for part in out.split('#\n')[1:]:
+        lines = [l for l in part.splitlines() if l.startswith('20;') and 'RFLink' not in l and 'DEBUG' not in l]
+        result.append(lines[0][6:] if lines else None) # without the packet counter
+    return result
+
+if __name__ == '__main__':
+    for binary in sys.argv[1:]:
+        result = decodes(os.path.abspath(binary))
+        rows, wrong = {}, [0] * (len(FACTORS) + 1)
+        for start in range(0, len(result), block):
+            ref = result[start]
+            if not ref:
+                continue
+            name = ref.split(';')[0]
+            row = rows.setdefault(name, [0, [0] * (len(FACTORS) + 1)])
+            row[0] += 1
+            for i, r in enumerate(result[start + 1:start + block]):
+                col = min(i, len(FACTORS))
+                if r == ref:
+                    row[1][col] += 1
+                elif r:
+                    wrong[col] += 1
+        print(binary)
+        print('%-22s' % 'factor' + ''.join('%5.2f' % f for f in FACTORS) + '  jitter')
+        for name in sorted(rows):
+            n, row = rows[name]
+            print('%-22s' % ('%s (%d)' % (name[:17], n)) + ''.join('%5d' % c for c in row[:-1]) + '%8d' % row[-1])
+        print('%-22s' % 'misdecoded' + ''.join('%5d' % c for c in wrong[:-1]) + '%8d' % wrong[-1])
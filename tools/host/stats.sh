@@ -0,0 +1,9 @@
+#!/bin/sh
+# 10;STATS; after a replay file, e.g. the CALLS / PACKETS ratio of the pulse count index
+# usage: [OFF=FLAG] tools/host/stats.sh <file> [compiler flags]
+HOST=$(cd "$(dirname "$0")" && pwd)
+FILE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+shift
+WORK=$(mktemp -d)
+(cd "$WORK" && "$HOST/build.sh" rflink "$@" && (cat "$FILE"; echo "S 10;STATS;") | ./rflink | grep ";STATS;")
+rm -rf "$WORK"
@@ -0,0 +1,225 @@
+// Host stand-ins for the Arduino core, FreeRTOS queues and tasks, and the ESP32 RMT driver.
+// Time only moves when the replay or the sketch asks it to (sim_us)
+
+#include <stdarg.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include <WiFi.h>
+#include <EEPROM.h>
+#include "driver/rmt.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+EEPROMClass EEPROM;
+
+unsigned long sim_us = 1000000;
+int sim_level = 0;
+void (*sim_isr)(void) = 0;
+std::string sim_serial_in;
+
+/*********************************************************************************************\
+ * Arduino core
+\*********************************************************************************************/
+int HardwareSerial::available() { return sim_serial_in.size(); }
+
+int HardwareSerial::read()
+{
+  if (sim_serial_in.empty())
+    return -1;
+  int c = (unsigned char)sim_serial_in[0];
+  sim_serial_in.erase(0, 1);
+  return c;
+}
+
+size_t HardwareSerial::printf(const char *f, ...)
+{
+  va_list a;
+  va_start(a, f);
+  int n = vprintf(f, a);
+  va_end(a);
+  return n;
+}
+
+unsigned long millis() { return sim_us / 1000; }
+unsigned long micros() { return sim_us; }
+void delay(unsigned long ms) { sim_us += ms * 1000; }
+void delayMicroseconds(unsigned int us) { sim_us += us; }
+void yield() {}
+int digitalRead(uint8_t)
+{
+  sim_us += 1;
+  return sim_level;
+}
+void digitalWrite(uint8_t, uint8_t) {}
+void pinMode(uint8_t, uint8_t) {}
+void attachInterrupt(uint8_t, void (*f)(void), int) { sim_isr = f; }
+void detachInterrupt(uint8_t) { sim_isr = 0; }
+void noInterrupts() {}
+void interrupts() {}
+void btStop() {}
+uint32_t EspClass::getCycleCount() { return sim_us * 160; }
+
+/*********************************************************************************************\
+ * FreeRTOS, tasks are registered but never run
+\*********************************************************************************************/
+struct SimQueue
+{
+  size_t Item;
+  UBaseType_t Length;
+  std::deque<std::string> Data;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t n, UBaseType_t size)
+{
+  SimQueue *q = new SimQueue;
+  q->Item = size;
+  q->Length = n;
+  return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t h, const void *p, TickType_t)
+{
+  SimQueue *q = (SimQueue *)h;
+  if (q->Data.size() >= q->Length)
+    return 0;
+  q->Data.push_back(std::string((const char *)p, q->Item));
+  return 1;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t h, void *p, TickType_t t)
+{
+  SimQueue *q = (SimQueue *)h;
+  if (q->Data.empty())
+  {
+    delay(t);
+    return 0;
+  }
+  memcpy(p, q->Data.front().data(), q->Item);
+  q->Data.pop_front();
+  return 1;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t h) { return ((SimQueue *)h)->Data.size(); }
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t h) { return ((SimQueue *)h)->Length - ((SimQueue *)h)->Data.size(); }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new int(1); } // 1 while free, a single thread never waits
+BaseType_t xSemaphoreTake(SemaphoreHandle_t h, TickType_t)
+{
+  if (*(int *)h == 0)
+    return 0;
+  *(int *)h = 0;
+  return 1;
+}
+BaseType_t xSemaphoreGive(SemaphoreHandle_t h)
+{
+  *(int *)h = 1;
+  return 1;
+}
+
+static int sim_tasks = 0;
+
+BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, unsigned, void *, UBaseType_t, TaskHandle_t *h, BaseType_t)
+{
+  *h = (void *)(long)(++sim_tasks);
+  return 1;
+}
+
+void vTaskDelete(TaskHandle_t) {}
+void vTaskDelay(TickType_t t) { delay(t); }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 1234; }
+
+/*********************************************************************************************\
+ * RMT receiver: edges from sim_rmt_edge() become one ring buffer item per idle-terminated frame
+\*********************************************************************************************/
+static std::vector<uint16_t> rmt_durations;
+static std::vector<int> rmt_levels;
+static std::deque<std::vector<rmt_item32_t>> rmt_frames;
+static std::vector<rmt_item32_t> rmt_out;
+static unsigned long rmt_last_edge = 0;
+static bool rmt_running = false;
+static int rmt_idle = 5000;
+
+int rmt_config(const rmt_config_t *c)
+{
+  rmt_idle = c->rx_config.idle_threshold;
+  return 0;
+}
+int rmt_driver_install(rmt_channel_t, size_t, int) { return 0; }
+int rmt_get_ringbuf_handle(rmt_channel_t, RingbufHandle_t *h)
+{
+  *h = (void *)1;
+  return 0;
+}
+
+int rmt_rx_start(rmt_channel_t, bool)
+{
+  rmt_running = true;
+  rmt_durations.clear();
+  rmt_levels.clear();
+  rmt_last_edge = sim_us;
+  return 0;
+}
+
+int rmt_rx_stop(rmt_channel_t)
+{
+  rmt_running = false;
+  return 0;
+}
+
+static void rmt_flush()
+{
+  if (rmt_durations.empty())
+    return;
+  // Terminating zero duration, padded to whole items
+  do
+  {
+    rmt_durations.push_back(0);
+    rmt_levels.push_back(0);
+  } while (rmt_durations.size() & 1);
+
+  std::vector<rmt_item32_t> Frame;
+  for (size_t i = 0; i < rmt_durations.size(); i += 2)
+  {
+    rmt_item32_t Item;
+    Item.duration0 = rmt_durations[i];
+    Item.level0 = rmt_levels[i];
+    Item.duration1 = rmt_durations[i + 1];
+    Item.level1 = rmt_levels[i + 1];
+    Frame.push_back(Item);
+  }
+  rmt_frames.push_back(Frame);
+  rmt_durations.clear();
+  rmt_levels.clear();
+}
+
+void sim_rmt_edge() // after sim_level changed
+{
+  if (!rmt_running)
+    return;
+  unsigned long Length = sim_us - rmt_last_edge;
+  rmt_last_edge = sim_us;
+  if (Length >= (unsigned long)rmt_idle) // the first edge after idle opens a frame
+  {
+    rmt_flush();
+    return;
+  }
+  rmt_durations.push_back(Length);
+  rmt_levels.push_back(!sim_level);
+}
+
+void *xRingbufferReceive(RingbufHandle_t, size_t *size, int)
+{
+  if (rmt_running && !rmt_durations.empty() && sim_us - rmt_last_edge >= (unsigned long)rmt_idle)
+    rmt_flush();
+  if (rmt_frames.empty())
+    return 0;
+  rmt_out = rmt_frames.front();
+  rmt_frames.pop_front();
+  *size = rmt_out.size() * sizeof(rmt_item32_t);
+  return rmt_out.data();
+}
+
+void vRingbufferReturnItem(RingbufHandle_t, void *) {}
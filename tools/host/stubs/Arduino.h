@@ -0,0 +1,129 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+#include "binary.h"
+typedef uint8_t byte;
+typedef bool boolean;
+#define ARDUINO 10812
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strncat_P strncat
+#define strcmp_P strcmp
+#define strncasecmp_P strncasecmp
+#define memcpy_P memcpy
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define pgm_read_dword(a) (*(const uint32_t *)(a))
+#define pgm_read_ptr(a) (*(void *const *)(a))
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 3
+#define RISING 4
+#define FALLING 5
+#define NOT_A_PIN 255
+#define HEX 16
+#define DEC 10
+#define digitalPinToInterrupt(p) (p)
+class __FlashStringHelper;
+class String {
+public:
+  std::string s;
+  String() {}
+  String(const char *c) : s(c ? c : "") {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  const char *c_str() const { return s.c_str(); }
+  long toInt() const { return atol(s.c_str()); }
+  unsigned length() const { return s.size(); }
+  void trim() {}
+  void toCharArray(char *b, unsigned n) const { strncpy(b, s.c_str(), n); b[n - 1] = 0; }
+  bool operator==(const char *o) const { return s == o; }
+  String operator+(const String &o) const { String r; r.s = s + o.s; return r; }
+};
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  int available();
+  int read();
+  void flush() {}
+  size_t write(uint8_t c) { return fputc(c, stdout) != EOF; }
+  size_t print(const char *s) { return fputs(s, stdout); }
+  size_t print(const String &s) { return fputs(s.c_str(), stdout); }
+  size_t print(char c) { return fputc(c, stdout); }
+  size_t print(int v, int b = 10) { return b == 16 ? printf("%x", v) : printf("%d", v); }
+  size_t print(unsigned v, int b = 10) { return b == 16 ? printf("%x", v) : printf("%u", v); }
+  size_t print(long v, int b = 10) { return b == 16 ? printf("%lx", v) : printf("%ld", v); }
+  size_t print(unsigned long v, int b = 10) { return b == 16 ? printf("%lx", v) : printf("%lu", v); }
+  size_t print(double v, int = 2) { return printf("%.2f", v); }
+  template <class T> size_t println(T v) { size_t n = print(v); return n + print("\r\n"); }
+  template <class T> size_t println(T v, int b) { size_t n = print(v, b); return n + print("\r\n"); }
+  size_t println() { return print("\r\n"); }
+  size_t printf(const char *f, ...) __attribute__((format(printf, 2, 3)));
+};
+extern HardwareSerial Serial;
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long);
+void delayMicroseconds(unsigned int);
+void yield();
+int digitalRead(uint8_t);
+void digitalWrite(uint8_t, uint8_t);
+void pinMode(uint8_t, uint8_t);
+void attachInterrupt(uint8_t, void (*)(void), int);
+void detachInterrupt(uint8_t);
+void noInterrupts();
+void interrupts();
+void btStop();
+class EspClass {
+public:
+  void restart() {}
+  uint32_t getCycleCount();
+  uint32_t getFreeHeap() { return 100000; }
+  uint8_t getHeapFragmentation() { return 0; }
+  uint32_t getMaxFreeBlockSize() { return 50000; }
+  uint32_t getMaxAllocHeap() { return 50000; }
+  const char *getCoreVersion() { return "stub"; }
+};
+extern EspClass ESP;
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef STUB_FREERTOS
+#define STUB_FREERTOS
+typedef void *TaskHandle_t; typedef void *QueueHandle_t; typedef void *SemaphoreHandle_t; typedef unsigned long UBaseType_t; typedef int BaseType_t; typedef unsigned long TickType_t;
+#define pdTRUE 1
+#define pdMS_TO_TICKS(x) (x)
+#define portMAX_DELAY 0xFFFFFFFFUL
+QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t);
+BaseType_t xQueueSend(QueueHandle_t, const void *, TickType_t);
+BaseType_t xQueueReceive(QueueHandle_t, void *, TickType_t);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t);
+BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, unsigned, void *, UBaseType_t, TaskHandle_t *, BaseType_t);
+void vTaskDelete(TaskHandle_t); void vTaskDelay(TickType_t);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t);
+#endif
+#define clockCyclesPerMicrosecond() 160L
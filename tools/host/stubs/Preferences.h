@@ -0,0 +1,15 @@
+#pragma once
+#include <string.h>
+#include <stdio.h>
+// File backed NVS stand-in: nvs.bin in the current directory
+class Preferences {
+public:
+  bool begin(const char *, bool) { return true; }
+  void end() {}
+  size_t getBytes(const char *, void *buf, size_t len) {
+    FILE *f = fopen("nvs.bin", "rb"); if (!f) return 0;
+    size_t n = fread(buf, 1, len, f); fclose(f); return n; }
+  size_t putBytes(const char *, const void *buf, size_t len) {
+    FILE *f = fopen("nvs.bin", "wb"); if (!f) return 0;
+    size_t n = fwrite(buf, 1, len, f); fclose(f); return n; }
+};
@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+class WiFiClient;
+class PubSubClient {
+public:
+  void setClient(WiFiClient &) {}
+  void setServer(const char *, int) {}
+  void setCallback(void (*)(char *, byte *, unsigned int)) {}
+  bool connected() { return true; }
+  bool connect(const char *, const char *, const char *, const char * = 0, int = 0, bool = 0, const char * = 0) { return true; }
+  bool publish(const char *, const char *, bool = false) { return true; }
+  bool subscribe(const char *) { return true; }
+  bool loop() { return true; }
+  int state() { return 0; }
+};
@@ -0,0 +1,22 @@
+#pragma once
+#include <Arduino.h>
+#define WL_CONNECTED 3
+#define WIFI_STA 1
+#define WIFI_OFF 0
+#define WIFI_POWER_11dBm 44
+struct IPAddress { operator const char *() const { return "0.0.0.0"; } };
+inline uint32_t ipaddr_addr(const char *) { return 0; }
+class WiFiClass {
+public:
+  void persistent(bool) {}
+  void setAutoReconnect(bool) {}
+  void setTxPower(int) {}
+  void config(uint32_t, uint32_t, uint32_t) {}
+  void mode(int) {}
+  void begin(const char *, const char *) {}
+  int status() { return WL_CONNECTED; }
+  const char *localIP() { return "0.0.0.0"; }
+  int RSSI() { return -50; }
+  void disconnect() {}
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+typedef int rmt_channel_t; typedef int gpio_num_t; typedef void *RingbufHandle_t;
+enum { RMT_MODE_TX, RMT_MODE_RX };
+typedef struct { uint32_t duration0 : 15; uint32_t level0 : 1; uint32_t duration1 : 15; uint32_t level1 : 1; } rmt_item32_t;
+typedef struct { bool filter_en; uint8_t filter_ticks_thresh; uint16_t idle_threshold; } rmt_rx_config_t;
+typedef struct { int rmt_mode; rmt_channel_t channel; gpio_num_t gpio_num; uint8_t clk_div; uint8_t mem_block_num; union { rmt_rx_config_t rx_config; }; } rmt_config_t;
+int rmt_config(const rmt_config_t *);
+int rmt_driver_install(rmt_channel_t, size_t, int);
+int rmt_get_ringbuf_handle(rmt_channel_t, RingbufHandle_t *);
+int rmt_rx_start(rmt_channel_t, bool);
+int rmt_rx_stop(rmt_channel_t);
+void *xRingbufferReceive(RingbufHandle_t, size_t *, int);
+void vRingbufferReturnItem(RingbufHandle_t, void *);